@@ -26,6 +26,63 @@
 #ifndef _FLUXGARAGE_ROBOEYES_H
 #define _FLUXGARAGE_ROBOEYES_H
 
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include "FluxGarage_RoboEyes_Host.h" // millis(), random() and byte for builds without the Arduino core
+#endif
+#include "FluxGarage_RoboEyes_Raster.h"
+#include "FluxGarage_RoboEyes_Transport.h"
+#include "FluxGarage_RoboEyes_Sequence.h"
+#include "FluxGarage_RoboEyes_Snapshot.h"
+
+// Per-frame instrumentation, define ROBOEYES_PROFILING before including this file to turn it on
+#ifdef ROBOEYES_PROFILING
+#include "FluxGarage_RoboEyes_Profiler.h"
+#define ROBOEYES_PROFILE(call) profiler.call
+#else
+#define ROBOEYES_PROFILE(call)
+#endif
+
+// Features compiled in. To save flash, RAM and time per frame, define ROBOEYES_FEATURES before
+// including this file with only the features you use, e.g.
+// #define ROBOEYES_FEATURES (ROBOEYES_FEATURE_AUTOBLINKER | ROBOEYES_FEATURE_MOOD_HAPPY)
+// The setters of removed features don't exist, their flags are constant 0.
+#define ROBOEYES_FEATURE_MOOD_TIRED 0x0001
+#define ROBOEYES_FEATURE_MOOD_ANGRY 0x0002
+#define ROBOEYES_FEATURE_MOOD_HAPPY 0x0004
+#define ROBOEYES_FEATURE_CURIOUS 0x0008
+#define ROBOEYES_FEATURE_CYCLOPS 0x0010
+#define ROBOEYES_FEATURE_HFLICKER 0x0020
+#define ROBOEYES_FEATURE_VFLICKER 0x0040
+#define ROBOEYES_FEATURE_AUTOBLINKER 0x0080
+#define ROBOEYES_FEATURE_IDLE 0x0100
+#define ROBOEYES_FEATURE_CONFUSED 0x0200 // needs ROBOEYES_FEATURE_HFLICKER
+#define ROBOEYES_FEATURE_LAUGH 0x0400 // needs ROBOEYES_FEATURE_VFLICKER
+#define ROBOEYES_FEATURE_SEQUENCER 0x0800 // playSequence(), see FluxGarage_RoboEyes_Sequence.h
+#define ROBOEYES_FEATURE_GAZE 0x1000 // setGaze()
+#define ROBOEYES_FEATURE_VIEWPORT 0x2000 // setViewport()
+#define ROBOEYES_FEATURES_ALL 0x3FFF
+#ifndef ROBOEYES_FEATURES
+#define ROBOEYES_FEATURES ROBOEYES_FEATURES_ALL
+#endif
+#define ROBOEYES_HAS(feature) ((ROBOEYES_FEATURES) & ROBOEYES_FEATURE_##feature)
+#if ROBOEYES_HAS(CONFUSED) && !ROBOEYES_HAS(HFLICKER)
+#error "ROBOEYES_FEATURE_CONFUSED needs ROBOEYES_FEATURE_HFLICKER"
+#endif
+#if ROBOEYES_HAS(LAUGH) && !ROBOEYES_HAS(VFLICKER)
+#error "ROBOEYES_FEATURE_LAUGH needs ROBOEYES_FEATURE_VFLICKER"
+#endif
+
+// RAM target for one RoboEyes instance on AVR, checked at compile time: 215 bytes of state
+// plus the corner cache (and the profiler, if enabled). Define it yourself to check other platforms.
+#if defined(__AVR__) && !defined(ROBOEYES_STATE_SIZE_MAX)
+#ifdef ROBOEYES_PROFILING
+#define ROBOEYES_STATE_SIZE_MAX (215 + sizeof(RoboEyes_CornerCache) + sizeof(RoboEyes_Profiler))
+#else
+#define ROBOEYES_STATE_SIZE_MAX (215 + sizeof(RoboEyes_CornerCache))
+#endif
+#endif
 
 // Usage of monochrome display colors
 #define BGCOLOR 0 // background and overlays
@@ -37,10 +94,61 @@
 #define ANGRY 2
 #define HAPPY 3
 
+// For tweening groups
+#define TWEEN_SIZE 0 // eye widths and heights
+#define TWEEN_POSITION 1 // eye coordinates
+#define TWEEN_BORDERRADIUS 2
+#define TWEEN_SPACEBETWEEN 3
+#define TWEEN_EYELIDS 4 // mood eyelids
+
+// Animated parameters, see tweenValue(), tweenTarget() and setTweenEasing()
+#define ROBOEYES_PARAM_LWIDTH 0 // TWEEN_SIZE
+#define ROBOEYES_PARAM_LHEIGHT 1
+#define ROBOEYES_PARAM_RWIDTH 2
+#define ROBOEYES_PARAM_RHEIGHT 3
+#define ROBOEYES_PARAM_LRADIUS 4 // TWEEN_BORDERRADIUS
+#define ROBOEYES_PARAM_RRADIUS 5
+#define ROBOEYES_PARAM_SPACE 6 // TWEEN_SPACEBETWEEN
+#define ROBOEYES_PARAM_LX 7 // TWEEN_POSITION
+#define ROBOEYES_PARAM_LY 8
+#define ROBOEYES_PARAM_RX 9
+#define ROBOEYES_PARAM_RY 10
+#define ROBOEYES_PARAM_TIRED 11 // TWEEN_EYELIDS, only the moods compiled in are counted
+#define ROBOEYES_PARAM_ANGRY (ROBOEYES_PARAM_TIRED + (ROBOEYES_HAS(MOOD_TIRED) ? 1 : 0))
+#define ROBOEYES_PARAM_HAPPY (ROBOEYES_PARAM_ANGRY + (ROBOEYES_HAS(MOOD_ANGRY) ? 1 : 0))
+#define ROBOEYES_PARAMS (ROBOEYES_PARAM_HAPPY + (ROBOEYES_HAS(MOOD_HAPPY) ? 1 : 0))
+
+// TWEEN_ group of each animated parameter
+static const byte roboEyesTweenGroups[ROBOEYES_PARAMS] PROGMEM = {
+  TWEEN_SIZE, TWEEN_SIZE, TWEEN_SIZE, TWEEN_SIZE, TWEEN_BORDERRADIUS, TWEEN_BORDERRADIUS, TWEEN_SPACEBETWEEN,
+  TWEEN_POSITION, TWEEN_POSITION, TWEEN_POSITION, TWEEN_POSITION
+#if ROBOEYES_HAS(MOOD_TIRED)
+  , TWEEN_EYELIDS
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+  , TWEEN_EYELIDS
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+  , TWEEN_EYELIDS
+#endif
+};
+
+// Easing of a parameter towards its target
+#define ROBOEYES_EASE_OUT 0 // the remaining distance halves every half-life (default)
+#define ROBOEYES_EASE_LINEAR 1 // constant speed of ROBOEYES_LINEAR_PIXELS per half-life
+#define ROBOEYES_EASE_SMOOTH 2 // constant speed while far from the target, slowing down like ROBOEYES_EASE_OUT near it
+#define ROBOEYES_EASE_STEP 3 // jump to the target
+#ifndef ROBOEYES_LINEAR_PIXELS
+#define ROBOEYES_LINEAR_PIXELS 16
+#endif
+
 // For turning things on or off
 #define ON 1
 #define OFF 0
 
+// Returned by msUntilNextWork() while there's nothing to do until a setter is called
+#define ROBOEYES_NO_WORK 0xFFFFFFFFUL
+
 // For switch "predefined positions"
 #define N 1 // north, top center
 #define NE 2 // north-east, top right
@@ -52,7 +160,53 @@
 #define NW 8 // north-west, top left 
 // for middle center set "DEFAULT"
 
-class roboEyes
+#include "FluxGarage_RoboEyes_Expression.h" // its presets use the mood and position names above
+
+
+// Send a window of the frame buffer to the display. Displays offering displayRegion()
+// (see FluxGarage_RoboEyes_SSD1306.h) only get the changed columns and pages,
+// all others fall back to sending the whole frame. Returns the bytes sent.
+template <class Display>
+inline auto roboEyesFlush(Display &d, int16_t x0, int16_t x1, byte page0, byte page1, int) -> decltype(d.displayRegion(x0, x1, page0, page1)) {
+  return d.displayRegion(x0, x1, page0, page1);
+}
+template <class Display>
+inline unsigned int roboEyesFlush(Display &d, int16_t x0, int16_t x1, byte page0, byte page1, long) {
+  d.display();
+  return d.width()*((d.height()+7)/8);
+}
+
+// Returns the buffer of displays whose memory is organized in pages of 8 pixel rows, like
+// Adafruit_SSD1306 (in its default rotation) and RoboEyes_Framebuffer or classes derived from them, otherwise 0.
+class Adafruit_SSD1306;
+template <int WIDTH, int HEIGHT> class RoboEyes_Framebuffer;
+template <class Display>
+inline uint8_t *roboEyesPageBuffer(Display &d, const Adafruit_SSD1306 *) {
+  return d.getRotation() == 0 ? d.getBuffer() : 0;
+}
+template <class Display, int WIDTH, int HEIGHT>
+inline uint8_t *roboEyesPageBuffer(Display &d, const RoboEyes_Framebuffer<WIDTH, HEIGHT> *) {
+  return d.getBuffer();
+}
+template <class Display>
+inline uint8_t *roboEyesPageBuffer(Display &d, const void *) {
+  return 0;
+}
+
+// Returns displays that draw the layers of a frame themselves (see RoboEyes_LayerDisplay), otherwise 0
+inline RoboEyes_LayerDisplay *roboEyesLayerDisplay(RoboEyes_LayerDisplay *d) {
+  return d;
+}
+inline RoboEyes_LayerDisplay *roboEyesLayerDisplay(const void *) {
+  return 0;
+}
+
+// RoboEyes works with any display class offering the Adafruit GFX drawing methods used below
+// (fillRect, fillRoundRect, fillTriangle, clearDisplay, display, width, height). The display
+// type is a template parameter, so calls into the display are resolved at compile time and
+// non-virtual displays like RoboEyes_Framebuffer get their drawing methods inlined.
+template <class Display>
+class RoboEyes
 {
 private:
 
@@ -60,83 +214,285 @@ private:
 
 public:
 
+// The display this instance draws on
+Display &display;
+
+RoboEyes(Display &d) : display(d) {
+  adaptiveFramerate = 0;
+  eyeL_open = 0;
+  eyeR_open = 0;
+  fullRedraw = 1;
+  flushPending = 0;
+  flushFull = 0;
+  useNativeRaster = 1;
+#if ROBOEYES_HAS(VIEWPORT)
+  viewportClip = 0;
+#endif
+  settled = 0;
+  restored = 0;
+#if ROBOEYES_HAS(MOOD_TIRED)
+  tired = 0;
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+  angry = 0;
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+  happy = 0;
+#endif
+#if ROBOEYES_HAS(CURIOUS)
+  curious = 0;
+#endif
+#if ROBOEYES_HAS(CYCLOPS)
+  cyclops = 0;
+  lastFrameCyclops = 0;
+#endif
+#if ROBOEYES_HAS(HFLICKER)
+  hFlicker = 0;
+  hFlickerAlternate = 0;
+#endif
+#if ROBOEYES_HAS(VFLICKER)
+  vFlicker = 0;
+  vFlickerAlternate = 0;
+#endif
+#if ROBOEYES_HAS(AUTOBLINKER)
+  autoblinker = 0;
+#endif
+#if ROBOEYES_HAS(IDLE)
+  idle = 0;
+#endif
+#if ROBOEYES_HAS(CONFUSED)
+  confused = 0;
+  confusedToggle = 1;
+#endif
+#if ROBOEYES_HAS(LAUGH)
+  laugh = 0;
+  laughToggle = 1;
+#endif
+#if ROBOEYES_HAS(GAZE)
+  gaze = 0;
+#endif
+  // Start with closed eyes in the middle of a 128x64 screen
+  eyeLwidthCurrent() = eyeLwidthNext() = eyeLwidthDefault;
+  eyeLheightCurrent() = 1;
+  eyeLheightNext() = eyeLheightDefault;
+  eyeRwidthCurrent() = eyeRwidthNext() = eyeRwidthDefault;
+  eyeRheightCurrent() = 1;
+  eyeRheightNext() = eyeRheightDefault;
+  eyeLborderRadiusCurrent() = eyeLborderRadiusNext() = eyeLborderRadiusDefault;
+  eyeRborderRadiusCurrent() = eyeRborderRadiusNext() = eyeRborderRadiusDefault;
+  spaceBetweenCurrent() = spaceBetweenNext() = spaceBetweenDefault;
+  eyeLx() = eyeLxNext() = eyeLxDefault;
+  eyeLy() = eyeLyNext() = eyeLyDefault;
+  eyeRx() = eyeRxNext() = eyeRxDefault;
+  eyeRy() = eyeRyNext() = eyeRyDefault;
+#if ROBOEYES_HAS(MOOD_TIRED)
+  eyelidsTiredHeight() = eyelidsTiredHeightNext() = 0;
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+  eyelidsAngryHeight() = eyelidsAngryHeightNext() = 0;
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+  eyelidsHappyBottomOffset() = eyelidsHappyBottomOffsetNext() = 0;
+#endif
+#if defined(ROBOEYES_STATE_SIZE_MAX)
+  static_assert(sizeof(*this) <= ROBOEYES_STATE_SIZE_MAX, "RoboEyes state grew beyond ROBOEYES_STATE_SIZE_MAX, check the new members");
+#endif
+}
+
 // For general setup - screen size and max. frame rate
-int screenWidth = 128; // OLED display width, in pixels
-int screenHeight = 64; // OLED display height, in pixels
-int frameInterval = 20; // default value for 50 frames per second (1000/50 = 20 milliseconds)
-unsigned long fpsTimer = 0; // for timing the frames per second
+int16_t screenWidth = 128; // OLED display width, in pixels
+int16_t screenHeight = 64; // OLED display height, in pixels
+int16_t frameInterval = 20; // default value for 50 frames per second (1000/50 = 20 milliseconds)
+unsigned long fpsTimer = 0; // start time of the last frame
+
+// For frame pacing - frames are scheduled against absolute deadlines, late frames are skipped instead of catching up
+unsigned long nextFrameTime = 0; // deadline of the next frame, in milliseconds
+int16_t targetFrameInterval = 20; // frame interval set by setFramerate(), frameInterval may be longer in adaptive mode
+unsigned long frameTimeAverage = 0; // smoothed time for drawing and sending a frame, in microseconds
+unsigned long frameTimeWorst = 0; // longest time for drawing and sending a frame since the last resetFrameStats(), in microseconds
+uint16_t framesMissed = 0; // frame deadlines skipped since the last resetFrameStats()
+uint16_t framesCounted = 0; // frames drawn in the current measuring second
+uint16_t fpsMeasured = 0; // frames drawn in the last measuring second
+unsigned long fpsMeasureTimer = 0; // start of the current measuring second
+
+// For tweening - time based, independent from the frame rate
+uint16_t tweenHalfLife[5] = {10, 10, 10, 10, 10}; // time in milliseconds in which the remaining distance to the target halves, for each TWEEN_ group
+unsigned long tweenTimer = 0; // time of the last tweening step, 0 = none yet
+
+
+//*********************************************************************************************
+//  State Flags - one bit each, set in the constructor, constant 0 for features not compiled in
+//*********************************************************************************************
+
+// For frame pacing
+bool adaptiveFramerate : 1; // if true, lower the frame rate while drawing and sending a frame takes longer than the frame interval
 
 // For controlling mood types and expressions
-bool tired = 0;
-bool angry = 0;
-bool happy = 0;
-bool curious = 0; // if true, draw the outer eye larger when looking left or right
-bool cyclops = 0; // if true, draw only one eye
-bool eyeL_open = 0; // left eye opened or closed?
-bool eyeR_open = 0; // right eye opened or closed?
+#if ROBOEYES_HAS(MOOD_TIRED)
+bool tired : 1;
+#else
+static constexpr bool tired = 0;
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+bool angry : 1;
+#else
+static constexpr bool angry = 0;
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+bool happy : 1;
+#else
+static constexpr bool happy = 0;
+#endif
+#if ROBOEYES_HAS(CURIOUS)
+bool curious : 1; // if true, draw the outer eye larger when looking left or right
+#else
+static constexpr bool curious = 0;
+#endif
+#if ROBOEYES_HAS(CYCLOPS)
+bool cyclops : 1; // if true, draw only one eye
+bool lastFrameCyclops : 1; // cyclops mode of the previous frame
+#else
+static constexpr bool cyclops = 0;
+static constexpr bool lastFrameCyclops = 0;
+#endif
+bool eyeL_open : 1; // left eye opened or closed?
+bool eyeR_open : 1; // right eye opened or closed?
+
+// Macro animations, see below
+#if ROBOEYES_HAS(HFLICKER)
+bool hFlicker : 1;
+bool hFlickerAlternate : 1;
+#else
+static constexpr bool hFlicker = 0;
+#endif
+#if ROBOEYES_HAS(VFLICKER)
+bool vFlicker : 1;
+bool vFlickerAlternate : 1;
+#else
+static constexpr bool vFlicker = 0;
+#endif
+#if ROBOEYES_HAS(AUTOBLINKER)
+bool autoblinker : 1; // activate auto blink animation
+#else
+static constexpr bool autoblinker = 0;
+#endif
+#if ROBOEYES_HAS(IDLE)
+bool idle : 1; // idle mode: eyes looking in random directions
+#else
+static constexpr bool idle = 0;
+#endif
+#if ROBOEYES_HAS(CONFUSED)
+bool confused : 1; // eyes shaking left and right
+bool confusedToggle : 1;
+#else
+static constexpr bool confused = 0;
+#endif
+#if ROBOEYES_HAS(LAUGH)
+bool laugh : 1; // eyes shaking up and down
+bool laughToggle : 1;
+#else
+static constexpr bool laugh = 0;
+#endif
+#if ROBOEYES_HAS(GAZE)
+bool gaze : 1; // if true, the eye position follows setGaze()
+#else
+static constexpr bool gaze = 0;
+#endif
+
+// Partial screen updates, see below
+bool fullRedraw : 1; // if true, the next frame clears and sends the whole screen
+bool flushPending : 1; // if true, render() changed the screen region flushX0...flushPage1 and flush() has to send it
+bool flushFull : 1; // if true, flush() sends the whole screen
+bool useNativeRaster : 1; // if true, draw directly into the display buffer when possible (see FluxGarage_RoboEyes_Raster.h)
+#if ROBOEYES_HAS(VIEWPORT)
+bool viewportClip : 1; // if true, the eyes only draw into the viewport, see setViewport()
+#else
+static constexpr bool viewportClip = 0;
+#endif
+bool settled : 1; // all tweens reached their targets, update() does nothing until a setter or timer changes something
+bool restored : 1; // if true, the next frame draws the values set by restoreState() without animating them
 
 
 //*********************************************************************************************
 //  Eyes Geometry
 //*********************************************************************************************
 
-// EYE LEFT - size and border radius
-int eyeLwidthDefault = 36;
-int eyeLheightDefault = 36;
-int eyeLwidthCurrent = eyeLwidthDefault;
-int eyeLheightCurrent = 1; // start with closed eye, otherwise set to eyeLheightDefault
-int eyeLwidthNext = eyeLwidthDefault;
-int eyeLheightNext = eyeLheightDefault;
-int eyeLheightOffset = 0;
-// Border Radius
+// Initial geometry, kept as constants instead of per instance
+static constexpr int16_t eyeLxDefault = (128-(36+10+36))/2;
+static constexpr int16_t eyeLyDefault = (64-36)/2;
+static constexpr int16_t eyeRxDefault = eyeLxDefault+36+10;
+static constexpr int16_t eyeRyDefault = eyeLyDefault;
+
+// Shapes the eyes return to, e.g. after blinking
+int16_t eyeLwidthDefault = 36;
+int16_t eyeLheightDefault = 36;
 byte eyeLborderRadiusDefault = 8;
-byte eyeLborderRadiusCurrent = eyeLborderRadiusDefault;
-byte eyeLborderRadiusNext = eyeLborderRadiusDefault;
-
-// EYE RIGHT - size and border radius
-int eyeRwidthDefault = eyeLwidthDefault;
-int eyeRheightDefault = eyeLheightDefault;
-int eyeRwidthCurrent = eyeRwidthDefault;
-int eyeRheightCurrent = 1; // start with closed eye, otherwise set to eyeRheightDefault
-int eyeRwidthNext = eyeRwidthDefault;
-int eyeRheightNext = eyeRheightDefault;
-int eyeRheightOffset = 0;
-// Border Radius
+int16_t eyeRwidthDefault = eyeLwidthDefault;
+int16_t eyeRheightDefault = eyeLheightDefault;
 byte eyeRborderRadiusDefault = 8;
-byte eyeRborderRadiusCurrent = eyeRborderRadiusDefault;
-byte eyeRborderRadiusNext = eyeRborderRadiusDefault;
-
-// EYE LEFT - Coordinates
-int eyeLxDefault = ((screenWidth)-(eyeLwidthDefault+spaceBetweenDefault+eyeRwidthDefault))/2;
-int eyeLyDefault = ((screenHeight-eyeLheightDefault)/2);
-int eyeLx = eyeLxDefault;
-int eyeLy = eyeLyDefault;
-int eyeLxNext = eyeLx;
-int eyeLyNext = eyeLy;
-
-// EYE RIGHT - Coordinates
-int eyeRxDefault = eyeLx+eyeLwidthCurrent+spaceBetweenDefault;
-int eyeRyDefault = eyeLy;
-int eyeRx = eyeRxDefault;
-int eyeRy = eyeRyDefault;
-int eyeRxNext = eyeRx;
-int eyeRyNext = eyeRy;
-
-// BOTH EYES 
-// Eyelid top size
-byte eyelidsHeightMax = eyeLheightDefault/2; // top eyelids max height
-byte eyelidsTiredHeight = 0;
-byte eyelidsTiredHeightNext = eyelidsTiredHeight;
-byte eyelidsAngryHeight = 0;
-byte eyelidsAngryHeightNext = eyelidsAngryHeight;
-// Bottom happy eyelids offset
-byte eyelidsHappyBottomOffsetMax = (eyeLheightDefault/2)+3;
-byte eyelidsHappyBottomOffset = 0;
-byte eyelidsHappyBottomOffsetNext = 0;
-// Space between eyes
-int spaceBetweenDefault = 10;
-int spaceBetweenCurrent = spaceBetweenDefault;
-int spaceBetweenNext = 10;
+int16_t spaceBetweenDefault = 10;
+
+// Taller eyes when looking left or right, see setCuriosity()
+#if ROBOEYES_HAS(CURIOUS)
+int8_t eyeLheightOffset = 0;
+int8_t eyeRheightOffset = 0;
+#else
+static constexpr int8_t eyeLheightOffset = 0;
+static constexpr int8_t eyeRheightOffset = 0;
+#endif
+
+// Animated parameters, set in the constructor: current values and their targets, indexed by
+// ROBOEYES_PARAM_. render() moves them towards their targets in one loop, see tweenParams().
+int16_t tweenCurrent[ROBOEYES_PARAMS];
+int16_t tweenNext[ROBOEYES_PARAMS];
+// Named access to the animated parameters, e.g. roboEyes.eyeLxNext() = 10;
+int16_t &eyeLwidthCurrent(){return tweenCurrent[ROBOEYES_PARAM_LWIDTH];}
+int16_t &eyeLheightCurrent(){return tweenCurrent[ROBOEYES_PARAM_LHEIGHT];}
+int16_t &eyeRwidthCurrent(){return tweenCurrent[ROBOEYES_PARAM_RWIDTH];}
+int16_t &eyeRheightCurrent(){return tweenCurrent[ROBOEYES_PARAM_RHEIGHT];}
+int16_t &eyeLborderRadiusCurrent(){return tweenCurrent[ROBOEYES_PARAM_LRADIUS];}
+int16_t &eyeRborderRadiusCurrent(){return tweenCurrent[ROBOEYES_PARAM_RRADIUS];}
+int16_t &spaceBetweenCurrent(){return tweenCurrent[ROBOEYES_PARAM_SPACE];}
+int16_t &eyeLx(){return tweenCurrent[ROBOEYES_PARAM_LX];} // coordinates of the top left corners
+int16_t &eyeLy(){return tweenCurrent[ROBOEYES_PARAM_LY];}
+int16_t &eyeRx(){return tweenCurrent[ROBOEYES_PARAM_RX];}
+int16_t &eyeRy(){return tweenCurrent[ROBOEYES_PARAM_RY];}
+#if ROBOEYES_HAS(MOOD_TIRED)
+int16_t &eyelidsTiredHeight(){return tweenCurrent[ROBOEYES_PARAM_TIRED];} // top eyelids
+#else
+static constexpr byte eyelidsTiredHeight(){return 0;}
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+int16_t &eyelidsAngryHeight(){return tweenCurrent[ROBOEYES_PARAM_ANGRY];}
+#else
+static constexpr byte eyelidsAngryHeight(){return 0;}
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+int16_t &eyelidsHappyBottomOffset(){return tweenCurrent[ROBOEYES_PARAM_HAPPY];} // bottom eyelids
+#else
+static constexpr byte eyelidsHappyBottomOffset(){return 0;}
+#endif
+int16_t &eyeLwidthNext(){return tweenNext[ROBOEYES_PARAM_LWIDTH];}
+int16_t &eyeLheightNext(){return tweenNext[ROBOEYES_PARAM_LHEIGHT];}
+int16_t &eyeRwidthNext(){return tweenNext[ROBOEYES_PARAM_RWIDTH];}
+int16_t &eyeRheightNext(){return tweenNext[ROBOEYES_PARAM_RHEIGHT];}
+int16_t &eyeLborderRadiusNext(){return tweenNext[ROBOEYES_PARAM_LRADIUS];}
+int16_t &eyeRborderRadiusNext(){return tweenNext[ROBOEYES_PARAM_RRADIUS];}
+int16_t &spaceBetweenNext(){return tweenNext[ROBOEYES_PARAM_SPACE];}
+int16_t &eyeLxNext(){return tweenNext[ROBOEYES_PARAM_LX];}
+int16_t &eyeLyNext(){return tweenNext[ROBOEYES_PARAM_LY];}
+int16_t &eyeRxNext(){return tweenNext[ROBOEYES_PARAM_RX];} // follows the left eye, calculated by render()
+int16_t &eyeRyNext(){return tweenNext[ROBOEYES_PARAM_RY];}
+#if ROBOEYES_HAS(MOOD_TIRED)
+int16_t &eyelidsTiredHeightNext(){return tweenNext[ROBOEYES_PARAM_TIRED];} // eyelids follow the mood, calculated by render()
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+int16_t &eyelidsAngryHeightNext(){return tweenNext[ROBOEYES_PARAM_ANGRY];}
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+int16_t &eyelidsHappyBottomOffsetNext(){return tweenNext[ROBOEYES_PARAM_HAPPY];}
+#endif
+uint32_t tweenEasing = 0; // ROBOEYES_EASE_ of each parameter, 2 bits each, see setTweenEasing()
 
 
 //*********************************************************************************************
@@ -144,39 +500,97 @@ int spaceBetweenNext = 10;
 //*********************************************************************************************
 
 // Animation - horizontal flicker/shiver
-bool hFlicker = 0;
-bool hFlickerAlternate = 0;
+#if ROBOEYES_HAS(HFLICKER)
 byte hFlickerAmplitude = 2;
+#endif
 
 // Animation - vertical flicker/shiver
-bool vFlicker = 0;
-bool vFlickerAlternate = 0;
+#if ROBOEYES_HAS(VFLICKER)
 byte vFlickerAmplitude = 10;
+#endif
 
 // Animation - auto blinking
-bool autoblinker = 0; // activate auto blink animation
-int blinkInterval = 1; // basic interval between each blink in full seconds
-int blinkIntervalVariation = 4; // interval variaton range in full seconds, random number inside of given range will be add to the basic blinkInterval, set to 0 for no variation
+#if ROBOEYES_HAS(AUTOBLINKER)
+int16_t blinkInterval = 1; // basic interval between each blink in full seconds
+int16_t blinkIntervalVariation = 4; // interval variaton range in full seconds, random number inside of given range will be add to the basic blinkInterval, set to 0 for no variation
 unsigned long blinktimer = 0; // for organising eyeblink timing
+#endif
 
 // Animation - idle mode: eyes looking in random directions
-bool idle = 0;
-int idleInterval = 1; // basic interval between each eye repositioning in full seconds
-int idleIntervalVariation = 3; // interval variaton range in full seconds, random number inside of given range will be add to the basic idleInterval, set to 0 for no variation
+#if ROBOEYES_HAS(IDLE)
+int16_t idleInterval = 1; // basic interval between each eye repositioning in full seconds
+int16_t idleIntervalVariation = 3; // interval variaton range in full seconds, random number inside of given range will be add to the basic idleInterval, set to 0 for no variation
 unsigned long idleAnimationTimer = 0; // for organising eyeblink timing
+#endif
 
 // Animation - eyes confused: eyes shaking left and right
-bool confused = 0;
+#if ROBOEYES_HAS(CONFUSED)
 unsigned long confusedAnimationTimer = 0;
-int confusedAnimationDuration = 500;
-bool confusedToggle = 1;
+uint16_t confusedAnimationDuration = 500;
+#endif
 
 // Animation - eyes laughing: eyes shaking up and down
-bool laugh = 0;
+#if ROBOEYES_HAS(LAUGH)
 unsigned long laughAnimationTimer = 0;
-int laughAnimationDuration = 500;
-bool laughToggle = 1;
+uint16_t laughAnimationDuration = 500;
+#endif
+
+// Time and random numbers, see setClock() and setRandom()
+unsigned long (*clockSource)() = 0; // if set, used instead of millis()
+#if ROBOEYES_HAS(AUTOBLINKER) || ROBOEYES_HAS(IDLE)
+long (*randomSource)(long howBig) = 0; // if set, used instead of the built-in xorshift generator
+uint16_t randomState = 0xACE1; // state of the xorshift generator, never 0
+#endif
+
+// Sequencer, see playSequence()
+#if ROBOEYES_HAS(SEQUENCER)
+const uint8_t *sequenceNext = 0; // next instruction in flash, 0 = no sequence playing
+const uint8_t *sequenceMark = 0; // start of the looped part
+unsigned long sequenceTime = 0; // time of the next instruction
+byte sequenceLoops = 0; // number of times the looped part has been played
+#endif
+
+// Gaze, see setGaze()
+#if ROBOEYES_HAS(GAZE)
+int16_t gazeTargetX = 0; // last gaze set, -32768 = left/top, 0 = center, 32767 = right/bottom
+int16_t gazeTargetY = 0;
+int16_t gazeX = 0; // left eye position following the gaze target, in 1/16 pixels
+int16_t gazeY = 0;
+int16_t gazeVelocityX = 0; // in 1/16 pixels per second
+int16_t gazeVelocityY = 0;
+uint16_t gazeMaxVelocity = 0; // in pixels per second, 0 = no limit
+uint16_t gazeMaxAcceleration = 0; // in pixels per second per second, 0 = no limit
+#endif
+
+
+//*********************************************************************************************
+//  Partial Screen Updates
+//*********************************************************************************************
 
+// Bounding box of the eyes drawn in the previous frame, x1 < x0 means empty
+int16_t prevBoxX0 = 0;
+int16_t prevBoxY0 = 0;
+int16_t prevBoxX1 = -1;
+int16_t prevBoxY1 = -1;
+unsigned long bytesFlushed = 0; // bytes sent to the display in the last frame
+#if ROBOEYES_HAS(VIEWPORT)
+int16_t viewportX = 0; // left column of the viewport on the display, its size is screenWidth x screenHeight
+int16_t viewportY = 0; // top row of the viewport
+#else
+static constexpr int16_t viewportX = 0;
+static constexpr int16_t viewportY = 0;
+#endif
+int16_t flushX0 = 0; // screen region to send: columns flushX0...flushX1, pages flushPage0...flushPage1
+int16_t flushX1 = 0;
+byte flushPage0 = 0;
+byte flushPage1 = 0;
+RoboEyes_Transport *transport = 0; // if set, frames are sent without blocking from frontBuffer, see setAsyncFlush()
+uint8_t *frontBuffer = 0; // copy of the screen regions being sent, same size as the display buffer
+RoboEyes_CornerCache cornerCache; // corner tables of recently used border radii, see cornerCache.hits and cornerCache.misses
+
+#ifdef ROBOEYES_PROFILING
+RoboEyes_Profiler profiler; // section times, pixels and bytes of the last frames, see FluxGarage_RoboEyes_Profiler.h
+#endif
 
 //*********************************************************************************************
 //  GENERAL METHODS
@@ -186,21 +600,141 @@ bool laughToggle = 1;
 void begin(int width, int height, byte frameRate) {
 	screenWidth = width; // OLED display width, in pixels
 	screenHeight = height; // OLED display height, in pixels
+#if ROBOEYES_HAS(VIEWPORT)
+  viewportX = 0; // eyes use the whole screen until setViewport() is called
+  viewportY = 0;
+  viewportClip = 0;
+#endif
   display.clearDisplay(); // clear the display buffer
   display.display(); // show empty screen
-  eyeLheightCurrent = 1; // start with closed eyes
-  eyeRheightCurrent = 1; // start with closed eyes
+  eyeLheightCurrent() = 1; // start with closed eyes
+  eyeRheightCurrent() = 1; // start with closed eyes
   setFramerate(frameRate); // calculate frame interval based on defined frameRate
+  fullRedraw = 1; // first frame replaces the whole screen content
+  flushPending = 0;
+  flushFull = 0;
+  tweenTimer = 0; // start tweening from here
+  nextFrameTime = currentTime(); // draw first frame right away
+  resetFrameStats();
+}
+
+// Startup with the state saved by saveState() before a reset or deep sleep: no empty screen and
+// no opening eyes, the first frame shows the saved expression. Returns false and starts like
+// above if the snapshot isn't valid or was saved for another screen size.
+bool begin(int width, int height, byte frameRate, const uint8_t *snapshot) {
+  screenWidth = width;
+  screenHeight = height;
+#if ROBOEYES_HAS(VIEWPORT)
+  viewportX = 0;
+  viewportY = 0;
+  viewportClip = 0;
+#endif
+  setFramerate(frameRate);
+  if(!restoreState(snapshot)){
+    begin(width, height, frameRate);
+    return false;
+  }
+  flushPending = 0;
+  flushFull = 0;
+  nextFrameTime = currentTime(); // draw first frame right away
+  resetFrameStats();
+  return true;
 }
 
 void update(){
+  unsigned long now = currentTime(); // the only clock reading of this update
+#if ROBOEYES_HAS(SEQUENCER)
+  updateSequence(now);
+#endif
+  // Send a frame that had to wait for the transport as soon as it is free
+  if(transport){
+    transport->poll();
+    if(flushPending && !transport->busy()){
+      flush();
+    }
+  }
   // Limit drawing updates to defined max framerate
-  if(millis()-fpsTimer >= frameInterval){
-    drawEyes();
-    fpsTimer = millis();
+  if(!frameDue(now)){
+    return;
   }
+  unsigned long frameStart = micros();
+  drawEyes(fpsTimer);
+  measureFrame(fpsTimer, micros()-frameStart);
 }
 
+// Returns true if it's time for the next frame, and schedules the one after
+bool frameDue(){
+  return frameDue(currentTime());
+}
+bool frameDue(unsigned long now){
+  // Nothing to do while the eyes are at rest, draw right away when something changes
+  if(!isAnimating(now)){
+    nextFrameTime = now;
+    return false;
+  }
+  // Coming out of rest, a deadline that passed starts now: time at rest doesn't count as missed frames,
+  // also when update() wasn't called while at rest (see msUntilNextWork()). A deadline still ahead,
+  // e.g. staggered by RoboEyes_Scheduler::add(), is kept.
+  if(tweenTimer == 0 && (long)(now-nextFrameTime) > 0){
+    nextFrameTime = now;
+  }
+  if((long)(now-nextFrameTime) < 0){
+    return false;
+  }
+  // Skip deadlines that already passed instead of drawing the missed frames in a row
+  if(now-nextFrameTime >= (unsigned long)frameInterval){
+    framesMissed += (now-nextFrameTime)/frameInterval;
+    nextFrameTime = now;
+  }
+  nextFrameTime += frameInterval; // next deadline is independent of how long this frame takes
+  if(tweenTimer == 0 && framesCounted == 0){
+    fpsMeasureTimer = now; // first frame after rest, the time at rest isn't part of the frame rate
+  }
+  fpsTimer = now;
+  return true;
+}
+
+// Update frame statistics and, in adaptive mode, the frame interval
+void measureFrame(unsigned long now, unsigned long frameTime){
+  if(frameTime > frameTimeWorst){frameTimeWorst = frameTime;}
+  frameTimeAverage = frameTimeAverage ? frameTimeAverage - frameTimeAverage/8 + frameTime/8 : frameTime;
+  framesCounted++;
+  if(settled){
+    // At rest no frames are drawn, measuring starts again with the next frame (see frameDue())
+    fpsMeasured = 0;
+    framesCounted = 0;
+  } else if(now-fpsMeasureTimer >= 1000){
+    fpsMeasured = (unsigned long)framesCounted*1000/(now-fpsMeasureTimer);
+    framesCounted = 0;
+    fpsMeasureTimer = now;
+  }
+  if(adaptiveFramerate){
+    unsigned long budget = (unsigned long)frameInterval*1000;
+    if(frameTimeAverage > budget){
+      frameInterval = frameTimeAverage/1000+1; // slow down to what can be achieved
+    } else if(frameInterval > targetFrameInterval && frameTimeAverage < budget*3/4){
+      frameInterval--; // speed up again slowly
+    }
+  }
+}
+
+// Current time in milliseconds, read once per frame
+unsigned long currentTime(){
+  return clockSource ? clockSource() : millis();
+}
+
+#if ROBOEYES_HAS(AUTOBLINKER) || ROBOEYES_HAS(IDLE)
+// Random number from 0 to howBig-1
+long randomNumber(long howBig){
+  if(randomSource){return randomSource(howBig);}
+  if(howBig <= 0){return 0;}
+  randomState ^= randomState << 7; // xorshift with 16 bit state
+  randomState ^= randomState >> 9;
+  randomState ^= randomState << 8;
+  return randomState % howBig;
+}
+#endif
+
 
 //*********************************************************************************************
 //  SETTERS METHODS
@@ -209,165 +743,328 @@ void update(){
 // Calculate frame interval based on defined frameRate
 void setFramerate(byte fps){
   frameInterval = 1000/fps;
+  targetFrameInterval = frameInterval;
+}
+
+// Lower the frame rate automatically while drawing and sending a frame takes longer than
+// the frame interval, and go back up to the frame rate set by setFramerate() when possible
+void setAdaptiveFramerate(bool active){
+  adaptiveFramerate = active;
+  if(!active){
+    frameInterval = targetFrameInterval;
+  }
+}
+
+// Set tweening speed for one group (TWEEN_SIZE, TWEEN_POSITION, TWEEN_BORDERRADIUS, TWEEN_SPACEBETWEEN, TWEEN_EYELIDS):
+// time in milliseconds in which the remaining distance to the target halves, 0 = jump to target
+void setTweenHalfLife(byte group, unsigned int halfLife) {
+  tweenHalfLife[group] = halfLife;
+}
+// Set tweening speed for all groups
+void setTweenHalfLife(unsigned int halfLife) {
+  for(byte i = 0; i < 5; i++){
+    tweenHalfLife[i] = halfLife;
+  }
+}
+
+// Set the easing of one animated parameter (ROBOEYES_PARAM_), e.g. setTweenEasing(ROBOEYES_PARAM_LY, ROBOEYES_EASE_LINEAR),
+// can be ROBOEYES_EASE_OUT (default), ROBOEYES_EASE_LINEAR, ROBOEYES_EASE_SMOOTH or ROBOEYES_EASE_STEP.
+// The speed is set by the half-life of the parameter's group, see setTweenHalfLife().
+void setTweenEasing(byte param, byte easing) {
+  if(param >= ROBOEYES_PARAMS){return;} // eyelids of a mood not compiled in
+  tweenEasing = (tweenEasing & ~((uint32_t)3 << (2*param))) | ((uint32_t)(easing & 3) << (2*param));
+}
+// Set the easing of all animated parameters
+void setTweenEasing(byte easing) {
+  for(byte i = 0; i < ROBOEYES_PARAMS; i++){
+    setTweenEasing(i, easing);
+  }
 }
 
 void setWidth(byte leftEye, byte rightEye) {
-	eyeLwidthNext = leftEye;
-	eyeRwidthNext = rightEye;
+  settled = 0;
+	eyeLwidthNext() = leftEye;
+	eyeRwidthNext() = rightEye;
   eyeLwidthDefault = leftEye;
   eyeRwidthDefault = rightEye;
 }
 
 void setHeight(byte leftEye, byte rightEye) {
-	eyeLheightNext = leftEye;
-	eyeRheightNext = rightEye;
+  settled = 0;
+	eyeLheightNext() = leftEye;
+	eyeRheightNext() = rightEye;
   eyeLheightDefault = leftEye;
   eyeRheightDefault = rightEye;
 }
 
 // Set border radius for left and right eye
 void setBorderradius(byte leftEye, byte rightEye) {
-	eyeLborderRadiusNext = leftEye;
-	eyeRborderRadiusNext = rightEye;
+  settled = 0;
+	eyeLborderRadiusNext() = leftEye;
+	eyeRborderRadiusNext() = rightEye;
   eyeLborderRadiusDefault = leftEye;
   eyeRborderRadiusDefault = rightEye;
 }
 
 // Set space between the eyes, can also be negative
 void setSpacebetween(int space) {
-  spaceBetweenNext = space;
+  settled = 0;
+  spaceBetweenNext() = space;
   spaceBetweenDefault = space;
 }
 
 // Set mood expression
 void setMood(unsigned char mood)
   {
-    switch (mood)
-    {
-    case TIRED:
-      tired=1; 
-      angry=0; 
-      happy=0;
-      break;
-    case ANGRY:
-      tired=0; 
-      angry=1; 
-      happy=0;
-      break;
-    case HAPPY:
-      tired=0; 
-      angry=0; 
-      happy=1;
-      break;
-    default:
-      tired=0; 
-      angry=0; 
-      happy=0;
-      break;
-    }
+    (void)mood; // unused if no mood is compiled in
+    settled = 0;
+#if ROBOEYES_HAS(MOOD_TIRED)
+    tired = (mood == TIRED);
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+    angry = (mood == ANGRY);
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+    happy = (mood == HAPPY);
+#endif
   }
 
 // Set predefined position
 void setPosition(unsigned char position)
   {
+    settled = 0;
+#if ROBOEYES_HAS(GAZE)
+    gaze = 0; // stop following setGaze()
+#endif
     switch (position)
     {
     case N:
       // North, top center
-      eyeLxNext = getScreenConstraint_X()/2;
-      eyeLyNext = 0;
+      eyeLxNext() = getScreenConstraint_X()/2;
+      eyeLyNext() = 0;
       break;
     case NE:
       // North-east, top right
-      eyeLxNext = getScreenConstraint_X();
-      eyeLyNext = 0;
+      eyeLxNext() = getScreenConstraint_X();
+      eyeLyNext() = 0;
       break;
     case E:
       // East, middle right
-      eyeLxNext = getScreenConstraint_X();
-      eyeLyNext = getScreenConstraint_Y()/2;
+      eyeLxNext() = getScreenConstraint_X();
+      eyeLyNext() = getScreenConstraint_Y()/2;
       break;
     case SE:
       // South-east, bottom right
-      eyeLxNext = getScreenConstraint_X();
-      eyeLyNext = getScreenConstraint_Y();
+      eyeLxNext() = getScreenConstraint_X();
+      eyeLyNext() = getScreenConstraint_Y();
       break;
     case S:
       // South, bottom center
-      eyeLxNext = getScreenConstraint_X()/2;
-      eyeLyNext = getScreenConstraint_Y();
+      eyeLxNext() = getScreenConstraint_X()/2;
+      eyeLyNext() = getScreenConstraint_Y();
       break;
     case SW:
       // South-west, bottom left
-      eyeLxNext = 0;
-      eyeLyNext = getScreenConstraint_Y();
+      eyeLxNext() = 0;
+      eyeLyNext() = getScreenConstraint_Y();
       break;
     case W:
       // West, middle left
-      eyeLxNext = 0;
-      eyeLyNext = getScreenConstraint_Y()/2;
+      eyeLxNext() = 0;
+      eyeLyNext() = getScreenConstraint_Y()/2;
       break;
     case NW:
       // North-west, top left
-      eyeLxNext = 0;
-      eyeLyNext = 0;
+      eyeLxNext() = 0;
+      eyeLyNext() = 0;
       break;
     default:
       // Middle center
-      eyeLxNext = getScreenConstraint_X()/2;
-      eyeLyNext = getScreenConstraint_Y()/2;
+      eyeLxNext() = getScreenConstraint_X()/2;
+      eyeLyNext() = getScreenConstraint_Y()/2;
       break;
     }
   }
 
+// Set shapes, mood and position of an expression in flash memory (see FluxGarage_RoboEyes_Expression.h),
+// the eyes move there like after the single setters
+void morphTo(const RoboEyes_Expression *expression) {
+  setWidth(pgm_read_byte(&expression->widthLeft), pgm_read_byte(&expression->widthRight));
+  setHeight(pgm_read_byte(&expression->heightLeft), pgm_read_byte(&expression->heightRight));
+  setBorderradius(pgm_read_byte(&expression->borderRadiusLeft), pgm_read_byte(&expression->borderRadiusRight));
+  setSpacebetween((int8_t)pgm_read_byte(&expression->spaceBetween));
+  setMood(pgm_read_byte(&expression->mood));
+  byte position = pgm_read_byte(&expression->position);
+  if(position != ROBOEYES_KEEP_POSITION){
+    setPosition(position);
+  }
+}
+
+#if ROBOEYES_HAS(GAZE)
+// Set the gaze: x from -32768 (left) to 32767 (right), y from -32768 (top) to 32767 (bottom),
+// 0, 0 = middle center. Can be called as often as new sensor readings arrive, e.g. 1000 times
+// per second: only the last gaze before a frame counts, and the eyes are only redrawn when the
+// gaze moves them by at least one pixel. The eyes follow the gaze until setPosition() is called.
+void setGaze(int16_t x, int16_t y) {
+  gazeTargetX = x;
+  gazeTargetY = y;
+  if(!gaze){
+    // Start following from the current position
+    gaze = 1;
+    gazeX = eyeLxNext()*16;
+    gazeY = eyeLyNext()*16;
+    gazeVelocityX = 0;
+    gazeVelocityY = 0;
+    settled = 0;
+  } else if(settled && ((gazePosition(x, getScreenConstraint_X())+8)/16 != eyeLxNext() || (gazePosition(y, getScreenConstraint_Y())+8)/16 != eyeLyNext())){
+    settled = 0; // moves the eyes to another pixel, draw again
+  }
+}
+
+// Limit the speed of the eyes following setGaze(), in pixels per second (max. 2047) and pixels
+// per second per second, 0 = no limit. The tweening of TWEEN_POSITION is applied on top.
+void setGazeLimits(unsigned int maxVelocity, unsigned int maxAcceleration) {
+  gazeMaxVelocity = maxVelocity < 2047 ? maxVelocity : 2047;
+  gazeMaxAcceleration = maxAcceleration;
+}
+#endif
+
+#if ROBOEYES_HAS(AUTOBLINKER)
 // Set automated eye blinking, minimal blink interval in full seconds and blink interval variation range in full seconds
 void setAutoblinker(bool active, int interval, int variation){
+  settled = 0;
   autoblinker = active;
   blinkInterval = interval;
   blinkIntervalVariation = variation;
 }
 void setAutoblinker(bool active){
+  settled = 0;
   autoblinker = active;
 }
+#endif
 
+#if ROBOEYES_HAS(IDLE)
 // Set idle mode - automated eye repositioning, minimal time interval in full seconds and time interval variation range in full seconds
 void setIdleMode(bool active, int interval, int variation){
+  settled = 0;
   idle = active;
   idleInterval = interval;
   idleIntervalVariation = variation;
 }
 void setIdleMode(bool active) {
+  settled = 0;
   idle = active;
 }
+#endif
 
+#if ROBOEYES_HAS(CURIOUS)
 // Set curious mode - the respectively outer eye gets larger when looking left or right
 void setCuriosity(bool curiousBit) {
+  settled = 0;
   curious = curiousBit;
 }
+#endif
 
+#if ROBOEYES_HAS(CYCLOPS)
 // Set cyclops mode - show only one eye 
 void setCyclops(bool cyclopsBit) {
+  settled = 0;
   cyclops = cyclopsBit;
 }
+#endif
+
+// Leave the settled state, use this after changing animated parameters like eyeLxNext() directly
+void wake() {
+  settled = 0;
+}
 
+// Draw directly into the display buffer (default) or use the display's own drawing methods
+void setNativeRaster(bool active) {
+  useNativeRaster = active;
+  settled = 0;
+}
+
+// Set the time source in milliseconds, e.g. a simulated clock for fast-forwarding, 0 = millis()
+void setClock(unsigned long (*clockFunction)()) {
+  clockSource = clockFunction;
+  nextFrameTime = currentTime();
+  fpsMeasureTimer = nextFrameTime;
+  tweenTimer = 0;
+}
+
+#if ROBOEYES_HAS(AUTOBLINKER) || ROBOEYES_HAS(IDLE)
+// Set the source of random numbers for autoblinker and idle mode, e.g. Arduino's random,
+// 0 = built-in xorshift generator
+void setRandom(long (*randomFunction)(long howBig)) {
+  randomSource = randomFunction;
+}
+
+// Start the built-in generator over, the same seed gives the same random numbers
+void setRandomSeed(uint16_t seed) {
+  randomState = seed ? seed : 0xACE1;
+}
+#endif
+
+// Send frames without blocking: changed regions are copied into front (a buffer of the display buffer's size)
+// and handed to the transport, while the next frame is drawn. Only for displays with a page buffer
+// (Adafruit_SSD1306, RoboEyes_Framebuffer), 0 = back to sending directly from the display buffer.
+void setAsyncFlush(RoboEyes_Transport *asyncTransport, uint8_t *front) {
+  transport = asyncTransport;
+  frontBuffer = front;
+}
+
+// Clear and send the whole screen (or the whole viewport) with the next frame, use this after drawing other things on the display
+void forceFullRedraw() {
+  fullRedraw = 1;
+}
+
+#if ROBOEYES_HAS(VIEWPORT)
+// Show the eyes in a part of the display only: columns x...x+width-1, rows y...y+height-1.
+// Eye positions are relative to the viewport, and clearing, drawing and sending stay inside it,
+// so the rest of the display buffer is left to the sketch, e.g. for a status bar that is
+// updated at a much lower rate. Call after begin(), then set eye shapes and position to fit.
+void setViewport(int16_t x, int16_t y, int16_t width, int16_t height) {
+  if(x < 0){width += x; x = 0;}
+  if(y < 0){height += y; y = 0;}
+  if(x+width > display.width()){width = display.width()-x;}
+  if(y+height > display.height()){height = display.height()-y;}
+  viewportX = x;
+  viewportY = y;
+  screenWidth = (width > 0) ? width : 0;
+  screenHeight = (height > 0) ? height : 0;
+  viewportClip = (x != 0 || y != 0 || width != display.width() || height != display.height());
+  prevBoxX0 = 0; prevBoxY0 = 0; prevBoxX1 = -1; prevBoxY1 = -1; // the last box belongs to the old viewport
+  fullRedraw = 1;
+  settled = 0;
+}
+#endif
+
+#if ROBOEYES_HAS(HFLICKER)
 // Set horizontal flickering (displacing eyes left/right)
 void setHFlicker (bool flickerBit, byte Amplitude) {
+  settled = 0;
   hFlicker = flickerBit; // turn flicker on or off
   hFlickerAmplitude = Amplitude; // define amplitude of flickering in pixels
 }
 void setHFlicker (bool flickerBit) {
+  settled = 0;
   hFlicker = flickerBit; // turn flicker on or off
 }
+#endif
 
 
+#if ROBOEYES_HAS(VFLICKER)
 // Set vertical flickering (displacing eyes up/down)
 void setVFlicker (bool flickerBit, byte Amplitude) {
+  settled = 0;
   vFlicker = flickerBit; // turn flicker on or off
   vFlickerAmplitude = Amplitude; // define amplitude of flickering in pixels
 }
 void setVFlicker (bool flickerBit) {
+  settled = 0;
   vFlicker = flickerBit; // turn flicker on or off
 }
+#endif
 
 
 //*********************************************************************************************
@@ -376,7 +1073,7 @@ void setVFlicker (bool flickerBit) {
 
 // Returns the max x position for left eye
 int getScreenConstraint_X(){
-  return screenWidth-eyeLwidthCurrent-spaceBetweenCurrent-eyeRwidthCurrent;
+  return screenWidth-eyeLwidthCurrent()-spaceBetweenCurrent()-eyeRwidthCurrent();
 } 
 
 // Returns the max y position for left eye
@@ -384,6 +1081,86 @@ int getScreenConstraint_Y(){
  return screenHeight-eyeLheightDefault; // using default height here, because height will vary when blinking and in curious mode
 }
 
+// Returns true while the eyes are moving or a timed animation (autoblinker, idle mode) is due,
+// false if the eyes are at rest and update() would not draw anything
+bool isAnimating(){
+  return isAnimating(currentTime());
+}
+bool isAnimating(unsigned long now){
+  (void)now; // unused without autoblinker and idle mode
+  if(!settled || fullRedraw || flushPending){return true;}
+#if ROBOEYES_HAS(AUTOBLINKER)
+  if(autoblinker && now >= blinktimer){return true;}
+#endif
+#if ROBOEYES_HAS(IDLE)
+  if(idle && now >= idleAnimationTimer){return true;}
+#endif
+  return false;
+}
+
+// Returns the milliseconds until update() has something to do: 0 = call it right away,
+// ROBOEYES_NO_WORK = nothing until a setter is called. Until then, the board can sleep or the
+// task can wait, without delaying the next frame, blink, idle movement or sequence instruction.
+unsigned long msUntilNextWork(){
+  return msUntilNextWork(currentTime());
+}
+unsigned long msUntilNextWork(unsigned long now){
+  if(transport && (flushPending || transport->busy())){return 0;} // the transport is polled by update()
+  if(!settled || fullRedraw || flushPending){
+    long wait = (long)(nextFrameTime-now);
+    return wait > 0 ? wait : 0; // moving: wait for the next frame deadline, woken up from rest it has passed
+  }
+  unsigned long next = ROBOEYES_NO_WORK;
+#if ROBOEYES_HAS(AUTOBLINKER)
+  if(autoblinker){next = untilTime(next, blinktimer, now);}
+#endif
+#if ROBOEYES_HAS(IDLE)
+  if(idle){next = untilTime(next, idleAnimationTimer, now);}
+#endif
+#if ROBOEYES_HAS(SEQUENCER)
+  if(sequenceNext){
+    long wait = (long)(sequenceTime-now);
+    next = (wait <= 0) ? 0 : ((unsigned long)wait < next ? wait : next);
+  }
+#endif
+  return next;
+}
+
+// Returns the smaller of next and the milliseconds until time, the way the animation timers compare it with now
+static unsigned long untilTime(unsigned long next, unsigned long time, unsigned long now){
+  if(now >= time){return 0;}
+  return (time-now < next) ? time-now : next;
+}
+
+// Returns the number of bytes sent to the display in the last frame
+unsigned long getBytesFlushed(){
+  return bytesFlushed;
+}
+
+// Returns the number of frames drawn in the last second (0 while the eyes are at rest)
+unsigned int getFps(){
+  return fpsMeasured;
+}
+
+// Returns the longest time for drawing and sending a frame in microseconds
+unsigned long getWorstFrameTime(){
+  return frameTimeWorst;
+}
+
+// Returns the number of frame deadlines that were skipped because update() was called too late
+unsigned int getMissedFrames(){
+  return framesMissed;
+}
+
+// Start over with the frame statistics
+void resetFrameStats(){
+  frameTimeWorst = 0;
+  framesMissed = 0;
+  framesCounted = 0;
+  fpsMeasured = 0;
+  fpsMeasureTimer = currentTime();
+}
+
 
 //*********************************************************************************************
 //  BASIC ANIMATION METHODS
@@ -392,14 +1169,16 @@ int getScreenConstraint_Y(){
 // BLINKING FOR BOTH EYES AT ONCE
 // Close both eyes
 void close() {
-	eyeLheightNext = 1; // closing left eye
-  eyeRheightNext = 1; // closing right eye
+  settled = 0;
+	eyeLheightNext() = 1; // closing left eye
+  eyeRheightNext() = 1; // closing right eye
   eyeL_open = 0; // left eye not opened (=closed)
 	eyeR_open = 0; // right eye not opened (=closed)
 }
 
 // Open both eyes
 void open() {
+  settled = 0;
   eyeL_open = 1; // left eye opened - if true, drawEyes() will take care of opening eyes again
 	eyeR_open = 1; // right eye opened
 }
@@ -413,18 +1192,20 @@ void blink() {
 // BLINKING FOR SINGLE EYES, CONTROL EACH EYE SEPARATELY
 // Close eye(s)
 void close(bool left, bool right) {
+  settled = 0;
   if(left){
-    eyeLheightNext = 1; // blinking left eye
+    eyeLheightNext() = 1; // blinking left eye
     eyeL_open = 0; // left eye not opened (=closed)
   }
   if(right){
-      eyeRheightNext = 1; // blinking right eye
+      eyeRheightNext() = 1; // blinking right eye
       eyeR_open = 0; // right eye not opened (=closed)
   }
 }
 
 // Open eye(s)
 void open(bool left, bool right) {
+  settled = 0;
   if(left){
     eyeL_open = 1; // left eye opened - if true, drawEyes() will take care of opening eyes again
   }
@@ -444,197 +1225,1202 @@ void blink(bool left, bool right) {
 //  MACRO ANIMATION METHODS
 //*********************************************************************************************
 
+#if ROBOEYES_HAS(CONFUSED)
 // Play confused animation - one shot animation of eyes shaking left and right
 void anim_confused() {
+  settled = 0;
 	confused = 1;
 }
+#endif
 
+#if ROBOEYES_HAS(LAUGH)
 // Play laugh animation - one shot animation of eyes shaking up and down
 void anim_laugh() {
+  settled = 0;
   laugh = 1;
 }
+#endif
+
+//*********************************************************************************************
+//  COMMANDS
+//*********************************************************************************************
+
+// Run one instruction (see FluxGarage_RoboEyes_Sequence.h), instructions of features not compiled in are ignored
+void runCommand(const RoboEyes_Command &command) {
+  byte arg = command.arg;
+  switch(command.op){
+  case ROBOEYES_OP_OPEN: open(); break;
+  case ROBOEYES_OP_CLOSE: close(); break;
+  case ROBOEYES_OP_BLINK: blink(); break;
+  case ROBOEYES_OP_MOOD: setMood(arg); break;
+  case ROBOEYES_OP_POSITION: setPosition(arg); break;
+#if ROBOEYES_HAS(LAUGH)
+  case ROBOEYES_OP_LAUGH: anim_laugh(); break;
+#endif
+#if ROBOEYES_HAS(CONFUSED)
+  case ROBOEYES_OP_CONFUSED: anim_confused(); break;
+#endif
+#if ROBOEYES_HAS(AUTOBLINKER)
+  case ROBOEYES_OP_AUTOBLINKER: setAutoblinker(arg); break;
+#endif
+#if ROBOEYES_HAS(IDLE)
+  case ROBOEYES_OP_IDLE: setIdleMode(arg); break;
+#endif
+#if ROBOEYES_HAS(CURIOUS)
+  case ROBOEYES_OP_CURIOSITY: setCuriosity(arg); break;
+#endif
+#if ROBOEYES_HAS(CYCLOPS)
+  case ROBOEYES_OP_CYCLOPS: setCyclops(arg); break;
+#endif
+#if ROBOEYES_HAS(HFLICKER)
+  case ROBOEYES_OP_HFLICKER: setHFlicker(arg != 0, arg); break;
+#endif
+#if ROBOEYES_HAS(VFLICKER)
+  case ROBOEYES_OP_VFLICKER: setVFlicker(arg != 0, arg); break;
+#endif
+#if ROBOEYES_HAS(GAZE)
+  case ROBOEYES_OP_GAZE: setGaze(command.x, command.y); break;
+#endif
+  default: break;
+  }
+}
+
+// Run the commands waiting in a queue filled by other tasks (see FluxGarage_RoboEyes_Commands.h).
+// Call this in the render task right before update(), it's the only place where the eyes are changed then.
+template <class Queue>
+void runCommands(Queue &queue) {
+  RoboEyes_Command command;
+  for(unsigned int i = 0; i < Queue::capacity && queue.pop(command); i++){ // at most one queue length, so fast producers can't hold up the frame
+    runCommand(command);
+  }
+}
+
+#if ROBOEYES_HAS(SEQUENCER)
+// Play a sequence of instructions from flash memory (see FluxGarage_RoboEyes_Sequence.h), replacing
+// the sequence playing. The sequence is run by update(), its first instructions right away.
+void playSequence(const uint8_t *sequence) {
+  sequenceNext = sequence;
+  sequenceMark = sequence;
+  sequenceTime = currentTime();
+  sequenceLoops = 0;
+}
+
+// Stop the sequence playing, the eyes keep their current state
+void stopSequence() {
+  sequenceNext = 0;
+}
+
+// Returns true while a sequence is playing
+bool isSequencePlaying() {
+  return sequenceNext != 0;
+}
+
+// Run the instructions of the playing sequence that are due, called by update()
+void updateSequence() {
+  updateSequence(currentTime());
+}
+void updateSequence(unsigned long now) {
+  if(!sequenceNext || (long)(now-sequenceTime) < 0){
+    return; // nothing playing or waiting
+  }
+  while(sequenceNext){
+    byte op = pgm_read_byte(sequenceNext++);
+    if(op == ROBOEYES_OP_WAIT){
+      sequenceTime += (uint16_t)(pgm_read_byte(sequenceNext) | (pgm_read_byte(sequenceNext+1) << 8)); // relative to the previous instruction time, so waits don't drift
+      sequenceNext += 2;
+      if((long)(now-sequenceTime) < 0){return;}
+      continue;
+    }
+    RoboEyes_Command command = {op, 0, 0, 0};
+    if(op == ROBOEYES_OP_GAZE){
+      command.x = pgm_read_byte(sequenceNext) | (pgm_read_byte(sequenceNext+1) << 8);
+      command.y = pgm_read_byte(sequenceNext+2) | (pgm_read_byte(sequenceNext+3) << 8);
+      sequenceNext += 4;
+    } else if(op == ROBOEYES_OP_LOOP || op == ROBOEYES_OP_MOOD || op == ROBOEYES_OP_POSITION || op >= ROBOEYES_OP_AUTOBLINKER){
+      command.arg = pgm_read_byte(sequenceNext++);
+    }
+    switch(op){
+    case ROBOEYES_OP_END:
+      sequenceNext = 0;
+      break;
+    case ROBOEYES_OP_MARK:
+      sequenceMark = sequenceNext;
+      break;
+    case ROBOEYES_OP_LOOP:
+      if(command.arg == 0 || ++sequenceLoops < command.arg){
+        sequenceNext = sequenceMark;
+        return; // continue in the next update(), so a loop without wait can't block
+      }
+      sequenceLoops = 0;
+      break;
+    default:
+      runCommand(command);
+      break;
+    }
+  }
+}
+#endif
+
+//*********************************************************************************************
+//  TWEENING
+//*********************************************************************************************
+
+// Returns the part of the remaining distance (in 1/256) to cover after elapsed milliseconds,
+// so that the distance halves every halfLife milliseconds: 256 - 256 * 2^(-elapsed/halfLife).
+// At least 1 once any time passed, so long half-lives still move by a pixel per frame.
+int tweenFactor(unsigned long elapsed, unsigned int halfLife){
+  static const unsigned int remainingPart[17] = {256, 245, 235, 225, 215, 206, 197, 189, 181, 173, 166, 159, 152, 146, 140, 134, 128}; // 256 * 2^(-i/16)
+  if(halfLife == 0){return 256;}
+  if(elapsed == 0){return 0;}
+  if(elapsed >= 9UL*halfLife){return 256;} // less than 1/256 remaining
+  unsigned long steps = elapsed*256/halfLife; // elapsed time in 1/256 half-lives
+  byte i = (steps%256)/16; // interpolated between the 1/16 half-lives of the table
+  unsigned int remaining = remainingPart[i] - (remainingPart[i]-remainingPart[i+1])*(steps%16)/16;
+  int factor = 256 - (remaining >> (steps/256));
+  return (factor < 1) ? 1 : factor;
+}
+
+// Move value towards target by factor/256 of the distance, but at least one pixel
+int tween(int value, int target, int factor){
+  int distance = target-value;
+  if(distance == 0 || factor == 0){return value;}
+  int step = ((long)distance*factor)/256;
+  if(step == 0){step = (distance > 0) ? 1 : -1;}
+  return value+step;
+}
+
+// Current value of an animated parameter (ROBOEYES_PARAM_)
+int16_t &tweenValue(byte param){
+  return tweenCurrent[param];
+}
+
+// Target of an animated parameter (ROBOEYES_PARAM_)
+int16_t &tweenTarget(byte param){
+  return tweenNext[param];
+}
+
+// Move the parameters first...last towards goal, with the tweening factors of their groups and their easing
+void tweenParams(byte first, byte last, const int16_t *goal, unsigned long elapsed, const int *factors){
+  for(byte i = first; i <= last; i++){
+    byte group = pgm_read_byte(&roboEyesTweenGroups[i]);
+    byte easing = (tweenEasing >> (2*i)) & 3;
+    int16_t &current = tweenValue(i);
+    int value = current;
+    if(easing == ROBOEYES_EASE_OUT){
+      current = tween(value, goal[i], factors[group]);
+      continue;
+    }
+    // Linear step: ROBOEYES_LINEAR_PIXELS per half-life, at least one pixel
+    unsigned int halfLife = tweenHalfLife[group];
+    int distance = goal[i]-value;
+    if(easing == ROBOEYES_EASE_STEP || halfLife == 0 || distance == 0){
+      current = goal[i];
+      continue;
+    }
+    unsigned long pixels = elapsed*ROBOEYES_LINEAR_PIXELS/halfLife;
+    int step = (pixels < 1) ? 1 : (pixels > 0x7FFF) ? 0x7FFF : (int)pixels;
+    if(easing == ROBOEYES_EASE_SMOOTH){
+      int slowing = tween(value, goal[i], factors[group])-value; // ease-out step, smaller near the target
+      if(slowing < 0){slowing = -slowing;}
+      if(slowing < step){step = slowing;}
+    }
+    if(distance < 0){
+      current = (step < -distance) ? value-step : goal[i];
+    } else {
+      current = (step < distance) ? value+step : goal[i];
+    }
+  }
+}
+
+#if ROBOEYES_HAS(GAZE)
+// Position in 1/16 pixels for a gaze value from -32768 to 32767 along 0...constraint pixels
+int16_t gazePosition(int16_t gazeValue, int constraint){
+  if(constraint <= 0){return 0;}
+  return ((unsigned long)(gazeValue+32768)*constraint*16 + 32768) >> 16;
+}
+
+// Move the left eye's target position towards the gaze, called by render() while following setGaze()
+void updateGaze(unsigned long elapsed){
+  stepGaze(gazeX, gazeVelocityX, gazePosition(gazeTargetX, getScreenConstraint_X()), elapsed);
+  stepGaze(gazeY, gazeVelocityY, gazePosition(gazeTargetY, getScreenConstraint_Y()), elapsed);
+  eyeLxNext() = (gazeX+8)/16;
+  eyeLyNext() = (gazeY+8)/16;
+  if(gazeVelocityX || gazeVelocityY){
+    settled = 0; // still on the way to the gaze target
+  }
+}
+
+// Move one axis of the gaze (in 1/16 pixels) towards target within the velocity and acceleration limits
+void stepGaze(int16_t &position, int16_t &velocity, int16_t target, unsigned long elapsed){
+  long distance = target-position;
+  if(!gazeMaxVelocity && !gazeMaxAcceleration){
+    position = target; // no limits, jump to the target
+    velocity = 0;
+    return;
+  }
+  long maxVelocity = (gazeMaxVelocity ? gazeMaxVelocity : 2047)*16L;
+  long desired = (distance > 0) ? maxVelocity : (distance < 0) ? -maxVelocity : 0;
+  long v = velocity;
+  if(gazeMaxAcceleration){
+    unsigned long acceleration = gazeMaxAcceleration*16UL;
+    // Brake as soon as the distance needed for stopping reaches the remaining distance
+    if((v > 0) == (distance > 0) && (unsigned long)(v*v)/(2*acceleration) >= (unsigned long)labs(distance)){
+      desired = 0;
+    }
+    long change = acceleration*elapsed/1000;
+    if(change < 1){change = 1;}
+    if(desired > v){v = (v+change < desired) ? v+change : desired;}
+    else {v = (v-change > desired) ? v-change : desired;}
+  } else {
+    v = desired;
+  }
+  long step = v*(long)elapsed/1000;
+  if(step == 0 && v != 0){step = (v > 0) ? 1 : -1;}
+  // Stop at the target instead of overshooting it
+  if((distance >= 0 && v >= 0 && step >= distance) || (distance <= 0 && v <= 0 && step <= distance)){
+    position = target;
+    velocity = 0;
+    return;
+  }
+  position += step;
+  velocity = v;
+}
+#endif
+
+
+//*********************************************************************************************
+//  STATE SNAPSHOTS
+//*********************************************************************************************
+
+// Write the state of the eyes into snapshot (ROBOEYES_SNAPSHOT_SIZE bytes, see FluxGarage_RoboEyes_Snapshot.h),
+// e.g. to keep it in EEPROM or RTC memory. Returns the number of bytes written.
+unsigned int saveState(uint8_t *snapshot){
+  return saveState(snapshot, currentTime());
+}
+unsigned int saveState(uint8_t *snapshot, unsigned long now){
+  (void)now; // unused if no timed feature is compiled in
+  RoboEyes_SnapshotStream out(snapshot);
+  out.put8('R');
+  out.put8('S');
+  out.put8(ROBOEYES_SNAPSHOT_VERSION);
+  out.put8(ROBOEYES_SNAPSHOT_SIZE);
+
+  // Flags
+  uint32_t flags = 0;
+  if(eyeL_open){flags |= ROBOEYES_SNAPSHOT_LEFT_OPEN;}
+  if(eyeR_open){flags |= ROBOEYES_SNAPSHOT_RIGHT_OPEN;}
+  if(tired){flags |= ROBOEYES_SNAPSHOT_TIRED;}
+  if(angry){flags |= ROBOEYES_SNAPSHOT_ANGRY;}
+  if(happy){flags |= ROBOEYES_SNAPSHOT_HAPPY;}
+  if(curious){flags |= ROBOEYES_SNAPSHOT_CURIOUS;}
+  if(cyclops){flags |= ROBOEYES_SNAPSHOT_CYCLOPS;}
+  if(hFlicker){flags |= ROBOEYES_SNAPSHOT_HFLICKER;}
+  if(vFlicker){flags |= ROBOEYES_SNAPSHOT_VFLICKER;}
+#if ROBOEYES_HAS(HFLICKER)
+  if(hFlickerAlternate){flags |= ROBOEYES_SNAPSHOT_HFLICKER_ALTERNATE;}
+#endif
+#if ROBOEYES_HAS(VFLICKER)
+  if(vFlickerAlternate){flags |= ROBOEYES_SNAPSHOT_VFLICKER_ALTERNATE;}
+#endif
+  if(autoblinker){flags |= ROBOEYES_SNAPSHOT_AUTOBLINKER;}
+  if(idle){flags |= ROBOEYES_SNAPSHOT_IDLE;}
+  if(confused){flags |= ROBOEYES_SNAPSHOT_CONFUSED;}
+  if(laugh){flags |= ROBOEYES_SNAPSHOT_LAUGH;}
+#if ROBOEYES_HAS(CONFUSED)
+  if(confusedToggle){flags |= ROBOEYES_SNAPSHOT_CONFUSED_TOGGLE;}
+#endif
+#if ROBOEYES_HAS(LAUGH)
+  if(laughToggle){flags |= ROBOEYES_SNAPSHOT_LAUGH_TOGGLE;}
+#endif
+  if(gaze){flags |= ROBOEYES_SNAPSHOT_GAZE;}
+  if(adaptiveFramerate){flags |= ROBOEYES_SNAPSHOT_ADAPTIVE;}
+  if(viewportClip){flags |= ROBOEYES_SNAPSHOT_VIEWPORT;}
+  if(settled){flags |= ROBOEYES_SNAPSHOT_SETTLED;}
+  out.put32(flags);
+
+  // Screen
+  out.put16(screenWidth);
+  out.put16(screenHeight);
+  out.put16(viewportX);
+  out.put16(viewportY);
+
+  // Shapes: current values and targets, with all moods
+  for(byte i = 0; i <= ROBOEYES_PARAM_RY; i++){out.put16(tweenValue(i));}
+  out.put16(eyelidsTiredHeight());
+  out.put16(eyelidsAngryHeight());
+  out.put16(eyelidsHappyBottomOffset());
+  for(byte i = 0; i <= ROBOEYES_PARAM_RY; i++){out.put16(tweenTarget(i));}
+#if ROBOEYES_HAS(MOOD_TIRED)
+  out.put16(eyelidsTiredHeightNext());
+#else
+  out.put16(0);
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+  out.put16(eyelidsAngryHeightNext());
+#else
+  out.put16(0);
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+  out.put16(eyelidsHappyBottomOffsetNext());
+#else
+  out.put16(0);
+#endif
+  out.put16(eyeLwidthDefault);
+  out.put16(eyeLheightDefault);
+  out.put8(eyeLborderRadiusDefault);
+  out.put16(eyeRwidthDefault);
+  out.put16(eyeRheightDefault);
+  out.put8(eyeRborderRadiusDefault);
+  out.put16(spaceBetweenDefault);
+  out.put8(eyeLheightOffset);
+  out.put8(eyeRheightOffset);
+
+  // Animations, timers as time left
+#if ROBOEYES_HAS(HFLICKER)
+  out.put8(hFlickerAmplitude);
+#else
+  out.put8(0);
+#endif
+#if ROBOEYES_HAS(VFLICKER)
+  out.put8(vFlickerAmplitude);
+#else
+  out.put8(0);
+#endif
+#if ROBOEYES_HAS(AUTOBLINKER)
+  out.put16(blinkInterval);
+  out.put16(blinkIntervalVariation);
+#else
+  out.put32(0);
+#endif
+#if ROBOEYES_HAS(IDLE)
+  out.put16(idleInterval);
+  out.put16(idleIntervalVariation);
+#else
+  out.put32(0);
+#endif
+#if ROBOEYES_HAS(CONFUSED)
+  out.put16(confusedAnimationDuration);
+#else
+  out.put16(0);
+#endif
+#if ROBOEYES_HAS(LAUGH)
+  out.put16(laughAnimationDuration);
+#else
+  out.put16(0);
+#endif
+#if ROBOEYES_HAS(AUTOBLINKER)
+  out.put32(blinktimer > now ? blinktimer-now : 0);
+#else
+  out.put32(0);
+#endif
+#if ROBOEYES_HAS(IDLE)
+  out.put32(idleAnimationTimer > now ? idleAnimationTimer-now : 0);
+#else
+  out.put32(0);
+#endif
+#if ROBOEYES_HAS(CONFUSED)
+  out.put16(timeLeft(confusedAnimationTimer+confusedAnimationDuration, now));
+#else
+  out.put16(0);
+#endif
+#if ROBOEYES_HAS(LAUGH)
+  out.put16(timeLeft(laughAnimationTimer+laughAnimationDuration, now));
+#else
+  out.put16(0);
+#endif
+  for(byte group = 0; group < 5; group++){out.put16(tweenHalfLife[group]);}
+  out.put32(tweenEasing);
+#if ROBOEYES_HAS(AUTOBLINKER) || ROBOEYES_HAS(IDLE)
+  out.put16(randomState);
+#else
+  out.put16(0);
+#endif
+
+  // Gaze
+#if ROBOEYES_HAS(GAZE)
+  out.put16(gazeTargetX);
+  out.put16(gazeTargetY);
+  out.put16(gazeX);
+  out.put16(gazeY);
+  out.put16(gazeVelocityX);
+  out.put16(gazeVelocityY);
+  out.put16(gazeMaxVelocity);
+  out.put16(gazeMaxAcceleration);
+#else
+  for(byte i = 0; i < 8; i++){out.put16(0);}
+#endif
+
+  out.put16(out.checksum());
+  return out.position;
+}
+
+// Continue with the state written by saveState(), the next frame shows it without tweening from the
+// current state. Returns false and changes nothing if the snapshot isn't valid or was saved for another
+// screen size. A sequence playing is stopped.
+bool restoreState(const uint8_t *snapshot){
+  return restoreState(snapshot, currentTime());
+}
+bool restoreState(const uint8_t *snapshot, unsigned long now){
+  (void)now; // unused if no timed feature is compiled in
+  if(!snapshot || snapshot[0] != 'R' || snapshot[1] != 'S' || snapshot[2] != ROBOEYES_SNAPSHOT_VERSION || snapshot[3] != ROBOEYES_SNAPSHOT_SIZE){
+    return false;
+  }
+  RoboEyes_SnapshotStream check(snapshot);
+  while(check.position < ROBOEYES_SNAPSHOT_SIZE-2){check.get8();}
+  if(check.checksum() != (snapshot[ROBOEYES_SNAPSHOT_SIZE-2] | (snapshot[ROBOEYES_SNAPSHOT_SIZE-1] << 8))){
+    return false;
+  }
+  RoboEyes_SnapshotStream in(snapshot);
+  in.position = 4; // after the header
+  uint32_t flags = in.get32();
+
+  // Screen: the same, or a viewport fitting into the display
+  int16_t width = in.get16();
+  int16_t height = in.get16();
+  int16_t x = in.get16();
+  int16_t y = in.get16();
+  if(flags & ROBOEYES_SNAPSHOT_VIEWPORT){
+    if(!ROBOEYES_HAS(VIEWPORT) || x < 0 || y < 0 || x+width > display.width() || y+height > display.height()){return false;}
+#if ROBOEYES_HAS(VIEWPORT)
+    setViewport(x, y, width, height);
+#endif
+  } else if(width != screenWidth || height != screenHeight){
+    return false;
+  }
+
+  // Flags
+  eyeL_open = (flags & ROBOEYES_SNAPSHOT_LEFT_OPEN) != 0;
+  eyeR_open = (flags & ROBOEYES_SNAPSHOT_RIGHT_OPEN) != 0;
+#if ROBOEYES_HAS(MOOD_TIRED)
+  tired = (flags & ROBOEYES_SNAPSHOT_TIRED) != 0;
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+  angry = (flags & ROBOEYES_SNAPSHOT_ANGRY) != 0;
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+  happy = (flags & ROBOEYES_SNAPSHOT_HAPPY) != 0;
+#endif
+#if ROBOEYES_HAS(CURIOUS)
+  curious = (flags & ROBOEYES_SNAPSHOT_CURIOUS) != 0;
+#endif
+#if ROBOEYES_HAS(CYCLOPS)
+  cyclops = (flags & ROBOEYES_SNAPSHOT_CYCLOPS) != 0;
+  lastFrameCyclops = cyclops;
+#endif
+#if ROBOEYES_HAS(HFLICKER)
+  hFlicker = (flags & ROBOEYES_SNAPSHOT_HFLICKER) != 0;
+  hFlickerAlternate = (flags & ROBOEYES_SNAPSHOT_HFLICKER_ALTERNATE) != 0;
+#endif
+#if ROBOEYES_HAS(VFLICKER)
+  vFlicker = (flags & ROBOEYES_SNAPSHOT_VFLICKER) != 0;
+  vFlickerAlternate = (flags & ROBOEYES_SNAPSHOT_VFLICKER_ALTERNATE) != 0;
+#endif
+#if ROBOEYES_HAS(AUTOBLINKER)
+  autoblinker = (flags & ROBOEYES_SNAPSHOT_AUTOBLINKER) != 0;
+#endif
+#if ROBOEYES_HAS(IDLE)
+  idle = (flags & ROBOEYES_SNAPSHOT_IDLE) != 0;
+#endif
+#if ROBOEYES_HAS(CONFUSED)
+  confused = (flags & ROBOEYES_SNAPSHOT_CONFUSED) != 0;
+  confusedToggle = (flags & ROBOEYES_SNAPSHOT_CONFUSED_TOGGLE) != 0;
+#endif
+#if ROBOEYES_HAS(LAUGH)
+  laugh = (flags & ROBOEYES_SNAPSHOT_LAUGH) != 0;
+  laughToggle = (flags & ROBOEYES_SNAPSHOT_LAUGH_TOGGLE) != 0;
+#endif
+#if ROBOEYES_HAS(GAZE)
+  gaze = (flags & ROBOEYES_SNAPSHOT_GAZE) != 0;
+#endif
+  setAdaptiveFramerate((flags & ROBOEYES_SNAPSHOT_ADAPTIVE) != 0);
+
+  // Shapes
+  for(byte i = 0; i <= ROBOEYES_PARAM_RY; i++){tweenValue(i) = in.get16();}
+#if ROBOEYES_HAS(MOOD_TIRED)
+  eyelidsTiredHeight() = in.get16();
+#else
+  in.get16();
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+  eyelidsAngryHeight() = in.get16();
+#else
+  in.get16();
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+  eyelidsHappyBottomOffset() = in.get16();
+#else
+  in.get16();
+#endif
+  for(byte i = 0; i <= ROBOEYES_PARAM_RY; i++){tweenTarget(i) = in.get16();}
+#if ROBOEYES_HAS(MOOD_TIRED)
+  eyelidsTiredHeightNext() = in.get16();
+#else
+  in.get16();
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+  eyelidsAngryHeightNext() = in.get16();
+#else
+  in.get16();
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+  eyelidsHappyBottomOffsetNext() = in.get16();
+#else
+  in.get16();
+#endif
+  eyeLwidthDefault = in.get16();
+  eyeLheightDefault = in.get16();
+  eyeLborderRadiusDefault = in.get8();
+  eyeRwidthDefault = in.get16();
+  eyeRheightDefault = in.get16();
+  eyeRborderRadiusDefault = in.get8();
+  spaceBetweenDefault = in.get16();
+#if ROBOEYES_HAS(CURIOUS)
+  eyeLheightOffset = in.get8();
+  eyeRheightOffset = in.get8();
+#else
+  in.get16();
+#endif
+
+  // Animations, timers continue from now
+#if ROBOEYES_HAS(HFLICKER)
+  hFlickerAmplitude = in.get8();
+#else
+  in.get8();
+#endif
+#if ROBOEYES_HAS(VFLICKER)
+  vFlickerAmplitude = in.get8();
+#else
+  in.get8();
+#endif
+#if ROBOEYES_HAS(AUTOBLINKER)
+  blinkInterval = in.get16();
+  blinkIntervalVariation = in.get16();
+#else
+  in.get32();
+#endif
+#if ROBOEYES_HAS(IDLE)
+  idleInterval = in.get16();
+  idleIntervalVariation = in.get16();
+#else
+  in.get32();
+#endif
+#if ROBOEYES_HAS(CONFUSED)
+  confusedAnimationDuration = in.get16();
+#else
+  in.get16();
+#endif
+#if ROBOEYES_HAS(LAUGH)
+  laughAnimationDuration = in.get16();
+#else
+  in.get16();
+#endif
+#if ROBOEYES_HAS(AUTOBLINKER)
+  blinktimer = now+in.get32();
+#else
+  in.get32();
+#endif
+#if ROBOEYES_HAS(IDLE)
+  idleAnimationTimer = now+in.get32();
+#else
+  in.get32();
+#endif
+#if ROBOEYES_HAS(CONFUSED)
+  confusedAnimationTimer = now+(uint16_t)in.get16()-confusedAnimationDuration; // only used as start+duration, which may wrap around
+#else
+  in.get16();
+#endif
+#if ROBOEYES_HAS(LAUGH)
+  laughAnimationTimer = now+(uint16_t)in.get16()-laughAnimationDuration;
+#else
+  in.get16();
+#endif
+  for(byte group = 0; group < 5; group++){tweenHalfLife[group] = in.get16();}
+  tweenEasing = in.get32();
+#if ROBOEYES_HAS(AUTOBLINKER) || ROBOEYES_HAS(IDLE)
+  randomState = in.get16();
+  if(!randomState){randomState = 0xACE1;}
+#else
+  in.get16();
+#endif
+
+  // Gaze
+#if ROBOEYES_HAS(GAZE)
+  gazeTargetX = in.get16();
+  gazeTargetY = in.get16();
+  gazeX = in.get16();
+  gazeY = in.get16();
+  gazeVelocityX = in.get16();
+  gazeVelocityY = in.get16();
+  gazeMaxVelocity = in.get16();
+  gazeMaxAcceleration = in.get16();
+#endif
+
+#if ROBOEYES_HAS(SEQUENCER)
+  sequenceNext = 0; // an address in flash, not saved
+#endif
+  prevBoxX0 = 0; prevBoxY0 = 0; prevBoxX1 = -1; prevBoxY1 = -1;
+  fullRedraw = 1; // replace the whole screen (or viewport) with the restored eyes
+  settled = (flags & ROBOEYES_SNAPSHOT_SETTLED) != 0; // at rest or moving, as when saved
+  restored = 1; // the first frame shows the saved values, without a tweening step
+  tweenTimer = 0;
+  return true;
+}
+
+// Milliseconds from now until time, 0 if passed, at most 65535
+static uint16_t timeLeft(unsigned long time, unsigned long now){
+  long left = (long)(time-now);
+  if(left <= 0){return 0;}
+  return (left > 65535) ? 65535 : left;
+}
+
 
 //*********************************************************************************************
 //  PRE-CALCULATIONS AND ACTUAL DRAWINGS
 //*********************************************************************************************
 
+// Calculate and draw the next frame into the display buffer, and send it to the display
 void drawEyes(){
+  drawEyes(currentTime());
+}
+void drawEyes(unsigned long now){
+  render(now);
+  flush();
+}
+
+// Calculate and draw the next frame into the display buffer, without sending it to the display.
+// The changed screen region is remembered until flush() sends it. All animations of the frame
+// use the same time now, in milliseconds.
+void render(){
+  render(currentTime());
+}
+void render(unsigned long now){
+  ROBOEYES_PROFILE(begin());
+
+  // Last frame's geometry, for detecting whether this frame changes anything
+  int lastLx = eyeLx(); int lastLy = eyeLy(); int lastLwidth = eyeLwidthCurrent(); int lastLheight = eyeLheightCurrent(); byte lastLborderRadius = eyeLborderRadiusCurrent();
+  int lastRx = eyeRx(); int lastRy = eyeRy(); int lastRwidth = eyeRwidthCurrent(); int lastRheight = eyeRheightCurrent(); byte lastRborderRadius = eyeRborderRadiusCurrent();
+  byte lastTiredHeight = eyelidsTiredHeight(); byte lastAngryHeight = eyelidsAngryHeight(); byte lastHappyBottomOffset = eyelidsHappyBottomOffset();
+  bool lastCyclops = lastFrameCyclops;
+#if ROBOEYES_HAS(CYCLOPS)
+  lastFrameCyclops = cyclops;
+#endif
+  if(restored){
+    // Draw the saved frame as it is, the next frame continues the animations with one frame's tweening step
+    restored = 0;
+  } else {
+    settled = 1; // assume the eyes are at rest, parameters not at their goals and setters and timers called during this frame reset this
+    animate(now);
+  }
+
+  //// SETTLED STATE ////
+
+  // Compare with last frame's geometry - if nothing moved, there is nothing to draw or send
+  bool changed = eyeLx() != lastLx || eyeLy() != lastLy || eyeLwidthCurrent() != lastLwidth || eyeLheightCurrent() != lastLheight || eyeLborderRadiusCurrent() != lastLborderRadius
+              || eyeRx() != lastRx || eyeRy() != lastRy || eyeRwidthCurrent() != lastRwidth || eyeRheightCurrent() != lastRheight || eyeRborderRadiusCurrent() != lastRborderRadius
+              || eyelidsTiredHeight() != lastTiredHeight || eyelidsAngryHeight() != lastAngryHeight || eyelidsHappyBottomOffset() != lastHappyBottomOffset
+              || cyclops != lastCyclops;
+  // No rest while a shaking animation is running, even if it doesn't move the eyes in this frame
+  if(hFlicker || vFlicker || laugh || confused){
+    settled = 0;
+  }
+  if(settled){
+    tweenTimer = 0; // nothing moves until woken up, so don't count the time at rest
+  }
+  if(!changed && !fullRedraw){
+    if(!flushPending){ROBOEYES_PROFILE(end(0, 0));}
+    return; // identical frame, skip drawing and sending
+  }
+
+  //// DIRTY RECTANGLE ////
+
+  // Eye pixels are only ever set inside the eye rectangles, eyelids are drawn in background color on top
+  int boxX0 = eyeLx();
+  int boxY0 = eyeLy();
+  int boxX1 = eyeLx()+eyeLwidthCurrent()-1;
+  int boxY1 = eyeLy()+eyeLheightCurrent()-1;
+  if (!cyclops){
+    if(eyeRx() < boxX0){boxX0 = eyeRx();}
+    if(eyeRy() < boxY0){boxY0 = eyeRy();}
+    if(eyeRx()+eyeRwidthCurrent()-1 > boxX1){boxX1 = eyeRx()+eyeRwidthCurrent()-1;}
+    if(eyeRy()+eyeRheightCurrent()-1 > boxY1){boxY1 = eyeRy()+eyeRheightCurrent()-1;}
+  }
+  // Clip to screen
+  if(boxX0 < 0){boxX0 = 0;}
+  if(boxY0 < 0){boxY0 = 0;}
+  if(boxX1 > screenWidth-1){boxX1 = screenWidth-1;}
+  if(boxY1 > screenHeight-1){boxY1 = screenHeight-1;}
+  // Region to refresh = this frame's box united with the previous frame's box
+  int dirtyX0 = boxX0;
+  int dirtyY0 = boxY0;
+  int dirtyX1 = boxX1;
+  int dirtyY1 = boxY1;
+  if(boxX1 < boxX0 || boxY1 < boxY0){
+    dirtyX0 = prevBoxX0; dirtyY0 = prevBoxY0; dirtyX1 = prevBoxX1; dirtyY1 = prevBoxY1;
+  } else if(prevBoxX1 >= prevBoxX0 && prevBoxY1 >= prevBoxY0){
+    if(prevBoxX0 < dirtyX0){dirtyX0 = prevBoxX0;}
+    if(prevBoxY0 < dirtyY0){dirtyY0 = prevBoxY0;}
+    if(prevBoxX1 > dirtyX1){dirtyX1 = prevBoxX1;}
+    if(prevBoxY1 > dirtyY1){dirtyY1 = prevBoxY1;}
+  }
+  prevBoxX0 = boxX0; prevBoxY0 = boxY0; prevBoxX1 = boxX1; prevBoxY1 = boxY1;
+  // Eye coordinates are relative to the viewport, the region on the display isn't
+  if(viewportClip){
+    if(fullRedraw){
+      dirtyX0 = 0; dirtyY0 = 0; dirtyX1 = screenWidth-1; dirtyY1 = screenHeight-1; // the whole viewport, nothing outside
+    }
+    dirtyX0 += viewportX; dirtyX1 += viewportX;
+    dirtyY0 += viewportY; dirtyY1 += viewportY;
+  }
+  // The display is organized in pages of 8 pixel rows, so refresh whole pages
+  bool dirty = (dirtyX1 >= dirtyX0 && dirtyY1 >= dirtyY0);
+  byte page0 = dirtyY0/8;
+  byte page1 = dirtyY1/8;
+
+  //// ACTUAL DRAWINGS ////
+
+  // Draw straight into the display buffer if its memory layout is known, let displays without buffer
+  // draw the layers themselves in flush(), otherwise use the display's drawing methods
+  bool layerDisplay = useNativeRaster && roboEyesLayerDisplay(&display);
+  uint8_t *pageBuffer = (useNativeRaster && !layerDisplay) ? roboEyesPageBuffer(display, &display) : 0;
+  RoboEyes_Raster raster(pageBuffer, display.width(), display.height());
+
+  // Start with a blank screen, or blank region if only parts of the screen changed
+  if(layerDisplay){
+    // Nothing to clear, flush() draws the whole region
+  } else if(fullRedraw && !viewportClip){
+    display.clearDisplay();
+  } else if(dirty && !pageBuffer && viewportClip){
+    display.fillRect(dirtyX0, dirtyY0, dirtyX1-dirtyX0+1, dirtyY1-dirtyY0+1, BGCOLOR); // whole pages could reach beyond the viewport
+  } else if(dirty && !pageBuffer){
+    display.fillRect(dirtyX0, page0*8, dirtyX1-dirtyX0+1, (page1-page0+1)*8, BGCOLOR);
+  }
+
+  if(pageBuffer){
+    // The compositor writes every byte of the region once, no clearing needed
+    if(dirty){
+      if(viewportClip){
+        raster.setClip(viewportX, viewportY, viewportX+screenWidth-1, viewportY+screenHeight-1);
+      }
+      composeEyes(raster, dirtyX0, dirtyX1, page0, page1);
+    }
+  } else if(layerDisplay){
+    // Drawn by flush()
+  } else if(viewportClip){
+    if(dirty){
+      drawLayersClipped(display, dirtyX0, dirtyX1, dirtyY0, dirtyY1);
+    }
+  } else {
+    drawShapes(display);
+  }
+  ROBOEYES_PROFILE(section(ROBOEYES_PROFILE_RASTER));
+
+  // Remember what to send, united with a region that wasn't sent yet
+  if(fullRedraw){
+    if(!viewportClip){flushFull = 1;} // with a viewport, the dirty region already covers all of it
+    fullRedraw = 0;
+  }
+  if(dirty){
+    if(!flushPending){
+      flushX0 = dirtyX0; flushX1 = dirtyX1; flushPage0 = page0; flushPage1 = page1;
+    } else {
+      if(dirtyX0 < flushX0){flushX0 = dirtyX0;}
+      if(dirtyX1 > flushX1){flushX1 = dirtyX1;}
+      if(page0 < flushPage0){flushPage0 = page0;}
+      if(page1 > flushPage1){flushPage1 = page1;}
+    }
+    flushPending = 1;
+  }
+  if(flushFull){
+    flushPending = 1;
+  }
+  if(!flushPending){
+    ROBOEYES_PROFILE(end(0, 0)); // nothing visible before and after, nothing to send
+  }
 
+} // end of render method
+
+// Tweening steps and macro animations of one frame, all using the same time now
+void animate(unsigned long now){
   //// PRE-CALCULATIONS - EYE SIZES AND VALUES FOR ANIMATION TWEENINGS ////
 
+  // Time passed since the last frame
+  unsigned long elapsed = tweenTimer ? now-tweenTimer : frameInterval; // after a break, continue as if one frame has passed
+  tweenTimer = now;
+
+  // Eye position following setGaze()
+#if ROBOEYES_HAS(GAZE)
+  if(gaze){
+    updateGaze(elapsed);
+  }
+#endif
+
   // Vertical size offset for larger eyes when looking left or right (curious gaze)
+#if ROBOEYES_HAS(CURIOUS)
   if(curious){
-    if(eyeLxNext<=10){eyeLheightOffset=8;}
-    else if (eyeLxNext>=(getScreenConstraint_X()-10) && cyclops){eyeLheightOffset=8;}
+    if(eyeLxNext()<=10){eyeLheightOffset=8;}
+    else if (eyeLxNext()>=(getScreenConstraint_X()-10) && cyclops){eyeLheightOffset=8;}
     else{eyeLheightOffset=0;} // left eye
-    if(eyeRxNext>=screenWidth-eyeRwidthCurrent-10){eyeRheightOffset=8;}else{eyeRheightOffset=0;} // right eye
+    if(eyeRxNext()>=screenWidth-eyeRwidthCurrent()-10){eyeRheightOffset=8;}else{eyeRheightOffset=0;} // right eye
+  }
+#endif
+  // Tweening factors of each TWEEN_ group for the time passed since the last frame
+  int factors[5];
+  for(byte group = 0; group < 5; group++){
+    factors[group] = tweenFactor(elapsed, tweenHalfLife[group]);
+  }
+  int16_t goal[ROBOEYES_PARAMS]; // targets of this frame, including offsets
+  for(byte i = 0; i < ROBOEYES_PARAMS; i++){
+    goal[i] = tweenTarget(i);
   }
-  // Left eye height
-  eyeLheightCurrent = (eyeLheightCurrent + eyeLheightNext + eyeLheightOffset)/2;
-  eyeLy+= ((eyeLheightDefault-eyeLheightCurrent)/2); // vertical centering of eye when closing
-  eyeLy-= eyeLheightOffset/2;
-  // Right eye height
-  eyeRheightCurrent = (eyeRheightCurrent + eyeRheightNext + eyeRheightOffset)/2;
-  eyeRy+= (eyeRheightDefault-eyeRheightCurrent)/2; // vertical centering of eye when closing
-  eyeRy-= eyeRheightOffset/2;
 
+  // Sizes, border radii and space between, taller eyes in curious mode
+  goal[ROBOEYES_PARAM_LHEIGHT] += eyeLheightOffset;
+  goal[ROBOEYES_PARAM_RHEIGHT] += eyeRheightOffset;
+  tweenParams(ROBOEYES_PARAM_LWIDTH, ROBOEYES_PARAM_SPACE, goal, elapsed, factors);
 
-  // Open eyes again after closing them
+  // Open eyes again after closing them, a new target also keeps the eyes from coming to rest in this frame
 	if(eyeL_open){
-  	if(eyeLheightCurrent <= 1 + eyeLheightOffset){eyeLheightNext = eyeLheightDefault;} 
+  	if(eyeLheightCurrent() <= 1 + eyeLheightOffset && eyeLheightNext() != eyeLheightDefault){eyeLheightNext() = eyeLheightDefault; settled = 0;} 
   }
   if(eyeR_open){
-  	if(eyeRheightCurrent <= 1 + eyeRheightOffset){eyeRheightNext = eyeRheightDefault;} 
+  	if(eyeRheightCurrent() <= 1 + eyeRheightOffset && eyeRheightNext() != eyeRheightDefault){eyeRheightNext() = eyeRheightDefault; settled = 0;} 
   }
 
-  // Left eye width
-  eyeLwidthCurrent = (eyeLwidthCurrent + eyeLwidthNext)/2;
-  // Right eye width
-  eyeRwidthCurrent = (eyeRwidthCurrent + eyeRwidthNext)/2;
-
-
-  // Space between eyes
-  spaceBetweenCurrent = (spaceBetweenCurrent + spaceBetweenNext)/2;
-
-  // Left eye coordinates
-  eyeLx = (eyeLx + eyeLxNext)/2;
-  eyeLy = (eyeLy + eyeLyNext)/2;
-  // Right eye coordinates
-  eyeRxNext = eyeLxNext+eyeLwidthCurrent+spaceBetweenCurrent; // right eye's x position depends on left eyes position + the space between
-  eyeRyNext = eyeLyNext; // right eye's y position should be the same as for the left eye
-  eyeRx = (eyeRx + eyeRxNext)/2;
-  eyeRy = (eyeRy + eyeRyNext)/2;
+  // Right eye coordinates follow the left eye
+  eyeRxNext() = eyeLxNext()+eyeLwidthCurrent()+spaceBetweenCurrent(); // right eye's x position depends on left eyes position + the space between
+  eyeRyNext() = eyeLyNext(); // right eye's y position should be the same as for the left eye
+  goal[ROBOEYES_PARAM_RX] = eyeRxNext();
+  goal[ROBOEYES_PARAM_RY] = eyeRyNext();
+  // Vertically centered when closing and moved up for the larger curious eye
+  goal[ROBOEYES_PARAM_LY] += (eyeLheightDefault-eyeLheightCurrent())/2 - eyeLheightOffset/2;
+  goal[ROBOEYES_PARAM_RY] += (eyeRheightDefault-eyeRheightCurrent())/2 - eyeRheightOffset/2;
+  // Mood eyelids, in proportion to the eye height
+#if ROBOEYES_HAS(MOOD_TIRED)
+  eyelidsTiredHeightNext() = goal[ROBOEYES_PARAM_TIRED] = tired ? eyeLheightCurrent()/2 : 0;
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+  eyelidsAngryHeightNext() = goal[ROBOEYES_PARAM_ANGRY] = angry ? eyeLheightCurrent()/2 : 0;
+#endif
+#if ROBOEYES_HAS(MOOD_HAPPY)
+  eyelidsHappyBottomOffsetNext() = goal[ROBOEYES_PARAM_HAPPY] = happy ? eyeLheightCurrent()/2 : 0;
+#endif
+  tweenParams(ROBOEYES_PARAM_LX, ROBOEYES_PARAMS-1, goal, elapsed, factors);
+
+  // At rest only once every parameter reached its goal, not counting the right eye's size in cyclops mode
+  for(byte i = 0; i < ROBOEYES_PARAMS; i++){
+    if(tweenValue(i) != goal[i] && !(cyclops && (i == ROBOEYES_PARAM_RWIDTH || i == ROBOEYES_PARAM_RHEIGHT || i == ROBOEYES_PARAM_SPACE))){
+      settled = 0;
+    }
+  }
 
-  // Left eye border radius
-  eyeLborderRadiusCurrent = (eyeLborderRadiusCurrent + eyeLborderRadiusNext)/2;
-  // Right eye border radius
-  eyeRborderRadiusCurrent = (eyeRborderRadiusCurrent + eyeRborderRadiusNext)/2;
-  
+  ROBOEYES_PROFILE(section(ROBOEYES_PROFILE_TWEEN));
 
   //// APPLYING MACRO ANIMATIONS ////
 
+#if ROBOEYES_HAS(AUTOBLINKER)
 	if(autoblinker){
-		if(millis() >= blinktimer){
+		if(now >= blinktimer){
 		blink();
-		blinktimer = millis()+(blinkInterval*1000)+(random(blinkIntervalVariation)*1000); // calculate next time for blinking
+		blinktimer = now+(blinkInterval*1000)+(randomNumber(blinkIntervalVariation)*1000); // calculate next time for blinking
 		}
 	}
+#endif
 
   // Laughing - eyes shaking up and down for the duration defined by laughAnimationDuration (default = 500ms)
+#if ROBOEYES_HAS(LAUGH)
   if(laugh){
     if(laughToggle){
       setVFlicker(1, 5);
-      laughAnimationTimer = millis();
+      laughAnimationTimer = now;
       laughToggle = 0;
-    } else if(millis() >= laughAnimationTimer+laughAnimationDuration){
+    } else if(now >= laughAnimationTimer+laughAnimationDuration){
       setVFlicker(0, 0);
       laughToggle = 1;
       laugh=0; 
     }
   }
+#endif
 
   // Confused - eyes shaking left and right for the duration defined by confusedAnimationDuration (default = 500ms)
+#if ROBOEYES_HAS(CONFUSED)
   if(confused){
     if(confusedToggle){
       setHFlicker(1, 20);
-      confusedAnimationTimer = millis();
+      confusedAnimationTimer = now;
       confusedToggle = 0;
-    } else if(millis() >= confusedAnimationTimer+confusedAnimationDuration){
+    } else if(now >= confusedAnimationTimer+confusedAnimationDuration){
       setHFlicker(0, 0);
       confusedToggle = 1;
       confused=0; 
     }
   }
+#endif
 
   // Idle - eyes moving to random positions on screen
+#if ROBOEYES_HAS(IDLE)
   if(idle){
-    if(millis() >= idleAnimationTimer){
-      eyeLxNext = random(getScreenConstraint_X());
-      eyeLyNext = random(getScreenConstraint_Y());
-      idleAnimationTimer = millis()+(idleInterval*1000)+(random(idleIntervalVariation)*1000); // calculate next time for eyes repositioning
+    if(now >= idleAnimationTimer){
+      eyeLxNext() = randomNumber(getScreenConstraint_X());
+      eyeLyNext() = randomNumber(getScreenConstraint_Y());
+      settled = 0;
+#if ROBOEYES_HAS(GAZE)
+      gaze = 0; // stop following setGaze()
+#endif
+      idleAnimationTimer = now+(idleInterval*1000)+(randomNumber(idleIntervalVariation)*1000); // calculate next time for eyes repositioning
     }
   }
+#endif
 
   // Adding offsets for horizontal flickering/shivering
+#if ROBOEYES_HAS(HFLICKER)
   if(hFlicker){
     if(hFlickerAlternate) {
-      eyeLx += hFlickerAmplitude;
-      eyeRx += hFlickerAmplitude;
+      eyeLx() += hFlickerAmplitude;
+      eyeRx() += hFlickerAmplitude;
     } else {
-      eyeLx -= hFlickerAmplitude;
-      eyeRx -= hFlickerAmplitude;
+      eyeLx() -= hFlickerAmplitude;
+      eyeRx() -= hFlickerAmplitude;
     }
     hFlickerAlternate = !hFlickerAlternate;
   }
+#endif
 
-  // Adding offsets for horizontal flickering/shivering
+  // Adding offsets for vertical flickering/shivering
+#if ROBOEYES_HAS(VFLICKER)
   if(vFlicker){
     if(vFlickerAlternate) {
-      eyeLy += vFlickerAmplitude;
-      eyeRy += vFlickerAmplitude;
+      eyeLy() += vFlickerAmplitude;
+      eyeRy() += vFlickerAmplitude;
     } else {
-      eyeLy -= vFlickerAmplitude;
-      eyeRy -= vFlickerAmplitude;
+      eyeLy() -= vFlickerAmplitude;
+      eyeRy() -= vFlickerAmplitude;
     }
     vFlickerAlternate = !vFlickerAlternate;
   }
+#endif
 
   // Cyclops mode, set second eye's size and space between to 0
   if(cyclops){
-    eyeRwidthCurrent = 0;
-    eyeRheightCurrent = 0;
-    spaceBetweenCurrent = 0;
+    eyeRwidthCurrent() = 0;
+    eyeRheightCurrent() = 0;
+    spaceBetweenCurrent() = 0;
   }
 
-  //// ACTUAL DRAWINGS ////
+  ROBOEYES_PROFILE(section(ROBOEYES_PROFILE_MACRO));
+} // end of animate method
+
+// Send the screen region changed by render() to the display, returns the number of bytes sent
+unsigned long flush(){
+  if(!flushPending){
+    bytesFlushed = 0;
+    return 0;
+  }
+  RoboEyes_LayerDisplay *layerDisplay = useNativeRaster ? roboEyesLayerDisplay(&display) : 0;
+  uint8_t *backBuffer = (transport && !layerDisplay) ? roboEyesPageBuffer(display, &display) : 0;
+  if(layerDisplay){
+    if(flushFull){
+      flushX0 = 0; flushX1 = display.width()-1; flushPage0 = 0; flushPage1 = (display.height()-1)/8;
+    }
+    RoboEyes_Layer layers[ROBOEYES_MAX_LAYERS];
+    byte count = eyeLayers(layers);
+    int firstRow = flushPage0*8;
+    int lastRow = flushPage1*8+7;
+    if(lastRow > display.height()-1){lastRow = display.height()-1;}
+    if(viewportClip){
+      if(firstRow < viewportY){firstRow = viewportY;}
+      if(lastRow > viewportY+screenHeight-1){lastRow = viewportY+screenHeight-1;}
+    }
+    bytesFlushed = layerDisplay->drawLayers(layers, count, flushX0, flushX1, firstRow, lastRow);
+  } else if(backBuffer){
+    // Don't wait for the previous transfer, the region stays pending and grows with the next frames
+    if(transport->busy()){
+      bytesFlushed = 0;
+      return 0;
+    }
+    if(flushFull){
+      flushX0 = 0; flushX1 = display.width()-1; flushPage0 = 0; flushPage1 = (display.height()-1)/8;
+    }
+    for(byte page = flushPage0; page <= flushPage1; page++){
+      unsigned int offset = page*display.width() + flushX0;
+      memcpy(frontBuffer+offset, backBuffer+offset, flushX1-flushX0+1);
+    }
+    transport->send(frontBuffer, display.width(), flushX0, flushX1, flushPage0, flushPage1);
+    bytesFlushed = (flushX1-flushX0+1)*(flushPage1-flushPage0+1);
+  } else if(flushFull){
+    display.display();
+    bytesFlushed = screenWidth*((screenHeight+7)/8);
+  } else {
+    bytesFlushed = roboEyesFlush(display, flushX0, flushX1, flushPage0, flushPage1, 0);
+  }
+  ROBOEYES_PROFILE(section(ROBOEYES_PROFILE_FLUSH));
+  ROBOEYES_PROFILE(end(flushFull ? (unsigned long)screenWidth*screenHeight : (unsigned long)(flushX1-flushX0+1)*(flushPage1-flushPage0+1)*8, bytesFlushed));
+  flushPending = 0;
+  flushFull = 0;
+  return bytesFlushed;
+}
+
+// Returns the number of bytes flush() will send, 0 if nothing changed
+unsigned int pendingBytes(){
+  if(!flushPending){return 0;}
+  if(flushFull){return screenWidth*((screenHeight+7)/8);}
+  return (flushX1-flushX0+1)*(flushPage1-flushPage0+1);
+}
 
-  display.clearDisplay(); // start with a blank screen
+// Draw eyes and eyelids, either with the display's drawing methods or with RoboEyes_Raster
+template <class Canvas>
+void drawShapes(Canvas &canvas){
 
   // Draw basic eye rectangles
-  display.fillRoundRect(eyeLx, eyeLy, eyeLwidthCurrent, eyeLheightCurrent, eyeLborderRadiusCurrent, MAINCOLOR); // left eye
+  canvas.fillRoundRect(eyeLx(), eyeLy(), eyeLwidthCurrent(), eyeLheightCurrent(), eyeLborderRadiusCurrent(), MAINCOLOR); // left eye
   if (!cyclops){
-    display.fillRoundRect(eyeRx, eyeRy, eyeRwidthCurrent, eyeRheightCurrent, eyeRborderRadiusCurrent, MAINCOLOR); // right eye
+    canvas.fillRoundRect(eyeRx(), eyeRy(), eyeRwidthCurrent(), eyeRheightCurrent(), eyeRborderRadiusCurrent(), MAINCOLOR); // right eye
   }
 
-  // Prepare mood type transitions
-  if (tired){eyelidsTiredHeightNext = eyeLheightCurrent/2; eyelidsAngryHeightNext = 0;} else{eyelidsTiredHeightNext = 0;}
-  if (angry){eyelidsAngryHeightNext = eyeLheightCurrent/2; eyelidsTiredHeightNext = 0;} else{eyelidsAngryHeightNext = 0;}
-  if (happy){eyelidsHappyBottomOffsetNext = eyeLheightCurrent/2;} else{eyelidsHappyBottomOffsetNext = 0;}
-
   // Draw tired top eyelids 
-    eyelidsTiredHeight = (eyelidsTiredHeight + eyelidsTiredHeightNext)/2;
+#if ROBOEYES_HAS(MOOD_TIRED)
     if (!cyclops){
-      display.fillTriangle(eyeLx, eyeLy-1, eyeLx+eyeLwidthCurrent, eyeLy-1, eyeLx, eyeLy+eyelidsTiredHeight-1, BGCOLOR); // left eye 
-      display.fillTriangle(eyeRx, eyeRy-1, eyeRx+eyeRwidthCurrent, eyeRy-1, eyeRx+eyeRwidthCurrent, eyeRy+eyelidsTiredHeight-1, BGCOLOR); // right eye
+      canvas.fillTriangle(eyeLx(), eyeLy()-1, eyeLx()+eyeLwidthCurrent(), eyeLy()-1, eyeLx(), eyeLy()+eyelidsTiredHeight()-1, BGCOLOR); // left eye 
+      canvas.fillTriangle(eyeRx(), eyeRy()-1, eyeRx()+eyeRwidthCurrent(), eyeRy()-1, eyeRx()+eyeRwidthCurrent(), eyeRy()+eyelidsTiredHeight()-1, BGCOLOR); // right eye
     } else {
       // Cyclops tired eyelids
-      display.fillTriangle(eyeLx, eyeLy-1, eyeLx+(eyeLwidthCurrent/2), eyeLy-1, eyeLx, eyeLy+eyelidsTiredHeight-1, BGCOLOR); // left eyelid half
-      display.fillTriangle(eyeLx+(eyeLwidthCurrent/2), eyeLy-1, eyeLx+eyeLwidthCurrent, eyeLy-1, eyeLx+eyeLwidthCurrent, eyeLy+eyelidsTiredHeight-1, BGCOLOR); // right eyelid half
+      canvas.fillTriangle(eyeLx(), eyeLy()-1, eyeLx()+(eyeLwidthCurrent()/2), eyeLy()-1, eyeLx(), eyeLy()+eyelidsTiredHeight()-1, BGCOLOR); // left eyelid half
+      canvas.fillTriangle(eyeLx()+(eyeLwidthCurrent()/2), eyeLy()-1, eyeLx()+eyeLwidthCurrent(), eyeLy()-1, eyeLx()+eyeLwidthCurrent(), eyeLy()+eyelidsTiredHeight()-1, BGCOLOR); // right eyelid half
     }
+#endif
 
   // Draw angry top eyelids 
-    eyelidsAngryHeight = (eyelidsAngryHeight + eyelidsAngryHeightNext)/2;
+#if ROBOEYES_HAS(MOOD_ANGRY)
     if (!cyclops){ 
-      display.fillTriangle(eyeLx, eyeLy-1, eyeLx+eyeLwidthCurrent, eyeLy-1, eyeLx+eyeLwidthCurrent, eyeLy+eyelidsAngryHeight-1, BGCOLOR); // left eye
-      display.fillTriangle(eyeRx, eyeRy-1, eyeRx+eyeRwidthCurrent, eyeRy-1, eyeRx, eyeRy+eyelidsAngryHeight-1, BGCOLOR); // right eye
+      canvas.fillTriangle(eyeLx(), eyeLy()-1, eyeLx()+eyeLwidthCurrent(), eyeLy()-1, eyeLx()+eyeLwidthCurrent(), eyeLy()+eyelidsAngryHeight()-1, BGCOLOR); // left eye
+      canvas.fillTriangle(eyeRx(), eyeRy()-1, eyeRx()+eyeRwidthCurrent(), eyeRy()-1, eyeRx(), eyeRy()+eyelidsAngryHeight()-1, BGCOLOR); // right eye
     } else {
       // Cyclops angry eyelids
-      display.fillTriangle(eyeLx, eyeLy-1, eyeLx+(eyeLwidthCurrent/2), eyeLy-1, eyeLx+(eyeLwidthCurrent/2), eyeLy+eyelidsAngryHeight-1, BGCOLOR); // left eyelid half
-      display.fillTriangle(eyeLx+(eyeLwidthCurrent/2), eyeLy-1, eyeLx+eyeLwidthCurrent, eyeLy-1, eyeLx+(eyeLwidthCurrent/2), eyeLy+eyelidsAngryHeight-1, BGCOLOR); // right eyelid half
+      canvas.fillTriangle(eyeLx(), eyeLy()-1, eyeLx()+(eyeLwidthCurrent()/2), eyeLy()-1, eyeLx()+(eyeLwidthCurrent()/2), eyeLy()+eyelidsAngryHeight()-1, BGCOLOR); // left eyelid half
+      canvas.fillTriangle(eyeLx()+(eyeLwidthCurrent()/2), eyeLy()-1, eyeLx()+eyeLwidthCurrent(), eyeLy()-1, eyeLx()+(eyeLwidthCurrent()/2), eyeLy()+eyelidsAngryHeight()-1, BGCOLOR); // right eyelid half
     }
+#endif
 
   // Draw happy bottom eyelids
-    eyelidsHappyBottomOffset = (eyelidsHappyBottomOffset + eyelidsHappyBottomOffsetNext)/2;
-    display.fillRoundRect(eyeLx-1, (eyeLy+eyeLheightCurrent)-eyelidsHappyBottomOffset+1, eyeLwidthCurrent+2, eyeLheightDefault, eyeLborderRadiusCurrent, BGCOLOR); // left eye
+#if ROBOEYES_HAS(MOOD_HAPPY)
+    canvas.fillRoundRect(eyeLx()-1, (eyeLy()+eyeLheightCurrent())-eyelidsHappyBottomOffset()+1, eyeLwidthCurrent()+2, eyeLheightDefault, eyeLborderRadiusCurrent(), BGCOLOR); // left eye
     if (!cyclops){ 
-      display.fillRoundRect(eyeRx-1, (eyeRy+eyeRheightCurrent)-eyelidsHappyBottomOffset+1, eyeRwidthCurrent+2, eyeRheightDefault, eyeRborderRadiusCurrent, BGCOLOR); // right eye
+      canvas.fillRoundRect(eyeRx()-1, (eyeRy()+eyeRheightCurrent())-eyelidsHappyBottomOffset()+1, eyeRwidthCurrent()+2, eyeRheightDefault, eyeRborderRadiusCurrent(), BGCOLOR); // right eye
     }
+#endif
+
+} // end of drawShapes method
+
+// Same eyes and eyelids as drawShapes(), but clipped to columns x0...x1 and rows y0...y1 (display
+// coordinates), for displays without page buffer when a viewport is set. Every column of a layer
+// is one fillRect() of the display, the region has to be cleared before.
+template <class Canvas>
+void drawLayersClipped(Canvas &canvas, int x0, int x1, int y0, int y1){
+  RoboEyes_Layer layers[ROBOEYES_MAX_LAYERS];
+  byte count = eyeLayers(layers);
+  for(int x = x0; x <= x1; x++){
+    // Eye layers come first, the cutting layers are drawn in background color over them
+    for(byte l = 0; l < count; l++){
+      int16_t top, bottom;
+      if(!RoboEyes_Raster::columnSpan(layers[l], x, top, bottom)){continue;}
+      if(top < y0){top = y0;}
+      if(bottom > y1){bottom = y1;}
+      if(top <= bottom){
+        canvas.fillRect(x, top, 1, bottom-top+1, (layers[l].type == ROBOEYES_LAYER_EYE) ? MAINCOLOR : BGCOLOR);
+      }
+    }
+  }
+}
+
+// Same eyes and eyelids as drawShapes(), but handed to the compositor as layers, which
+// writes the final pixels of columns x0...x1 in pages page0...page1 in one pass
+void composeEyes(RoboEyes_Raster &raster, int x0, int x1, byte page0, byte page1){
+  RoboEyes_Layer layers[ROBOEYES_MAX_LAYERS];
+  byte count = eyeLayers(layers);
+  raster.compose(x0, x1, page0, page1, layers, count);
+}
+
+// Fill in the shapes of the current frame for the compositor, eye layers first. Returns the number of layers.
+byte eyeLayers(RoboEyes_Layer *layers){
 
-  display.display(); // show drawings on display
+  // Corner tables for eyes and happy bottom eyelids
+  byte radiusL = RoboEyes_Raster::roundRectRadius(eyeLwidthCurrent(), eyeLheightCurrent(), eyeLborderRadiusCurrent());
+  byte radiusR = RoboEyes_Raster::roundRectRadius(eyeRwidthCurrent(), eyeRheightCurrent(), eyeRborderRadiusCurrent());
+  const uint8_t *insetL = cornerCache.get(radiusL);
+  const uint8_t *insetR = cornerCache.get(radiusR);
 
-} // end of drawEyes method
+  byte count = 0;
 
+  // Basic eye rectangles
+  layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_EYE, eyeLx(), eyeLy(), eyeLwidthCurrent(), eyeLheightCurrent(), radiusL, insetL); // left eye
+  if (!cyclops){
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_EYE, eyeRx(), eyeRy(), eyeRwidthCurrent(), eyeRheightCurrent(), radiusR, insetR); // right eye
+  }
 
+  // Tired and angry top eyelids, x = corner with the vertical edge, w = other top corner
+  if (!cyclops){
+#if ROBOEYES_HAS(MOOD_TIRED)
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeLx(), eyeLy()-1, eyeLx()+eyeLwidthCurrent(), eyelidsTiredHeight(), 0, 0); // left eye tired
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeRx()+eyeRwidthCurrent(), eyeRy()-1, eyeRx(), eyelidsTiredHeight(), 0, 0); // right eye tired
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeLx()+eyeLwidthCurrent(), eyeLy()-1, eyeLx(), eyelidsAngryHeight(), 0, 0); // left eye angry
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeRx(), eyeRy()-1, eyeRx()+eyeRwidthCurrent(), eyelidsAngryHeight(), 0, 0); // right eye angry
+#endif
+  } else {
+    // Cyclops eyelids, split into left and right half
+#if ROBOEYES_HAS(MOOD_TIRED)
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeLx(), eyeLy()-1, eyeLx()+(eyeLwidthCurrent()/2), eyelidsTiredHeight(), 0, 0); // tired left half
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeLx()+eyeLwidthCurrent(), eyeLy()-1, eyeLx()+(eyeLwidthCurrent()/2), eyelidsTiredHeight(), 0, 0); // tired right half
+#endif
+#if ROBOEYES_HAS(MOOD_ANGRY)
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeLx()+(eyeLwidthCurrent()/2), eyeLy()-1, eyeLx(), eyelidsAngryHeight(), 0, 0); // angry left half
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeLx()+(eyeLwidthCurrent()/2), eyeLy()-1, eyeLx()+eyeLwidthCurrent(), eyelidsAngryHeight(), 0, 0); // angry right half
+#endif
+  }
+
+  // Happy bottom eyelids
+#if ROBOEYES_HAS(MOOD_HAPPY)
+  byte radiusHappyL = RoboEyes_Raster::roundRectRadius(eyeLwidthCurrent()+2, eyeLheightDefault, eyeLborderRadiusCurrent());
+  byte radiusHappyR = RoboEyes_Raster::roundRectRadius(eyeRwidthCurrent()+2, eyeRheightDefault, eyeRborderRadiusCurrent());
+  const uint8_t *insetHappyL = cornerCache.get(radiusHappyL);
+  const uint8_t *insetHappyR = cornerCache.get(radiusHappyR);
+  layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_CUTOUT, eyeLx()-1, (eyeLy()+eyeLheightCurrent())-eyelidsHappyBottomOffset()+1, eyeLwidthCurrent()+2, eyeLheightDefault, radiusHappyL, insetHappyL); // left eye
+  if (!cyclops){
+    layers[count++] = RoboEyes_Raster::layer(ROBOEYES_LAYER_CUTOUT, eyeRx()-1, (eyeRy()+eyeRheightCurrent())-eyelidsHappyBottomOffset()+1, eyeRwidthCurrent()+2, eyeRheightDefault, radiusHappyR, insetHappyR); // right eye
+  }
+#endif
+
+  // Eye coordinates are relative to the viewport, layers are drawn in display coordinates
+  if(viewportX || viewportY){
+    for(byte l = 0; l < count; l++){
+      layers[l].x += viewportX;
+      layers[l].y += viewportY;
+      if(layers[l].type == ROBOEYES_LAYER_LID){layers[l].w += viewportX;} // eyelids keep their other top corner in w
+    }
+  }
+
+  return count;
+
+} // end of eyeLayers method
+
+
+}; // end of class RoboEyes
+
+// Definitions of the constants, needed by C++11 when they are used by reference
+template <class Display> constexpr int16_t RoboEyes<Display>::eyeLxDefault;
+template <class Display> constexpr int16_t RoboEyes<Display>::eyeLyDefault;
+template <class Display> constexpr int16_t RoboEyes<Display>::eyeRxDefault;
+template <class Display> constexpr int16_t RoboEyes<Display>::eyeRyDefault;
+
+
+// Classic usage: roboEyes draws on the global "display" object, which has to be declared in
+// the sketch before including this library. Define ROBOEYES_NO_GLOBAL_DISPLAY to turn this off.
+#if defined(ARDUINO) && !defined(ROBOEYES_NO_GLOBAL_DISPLAY)
+class roboEyes : public RoboEyes<decltype(::display)>
+{
+public:
+roboEyes() : RoboEyes<decltype(::display)>(::display) {}
 }; // end of class roboEyes
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,153 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Player for pre-baked animations (clips). A clip is recorded on a desktop computer with
+ * extras/host/RoboEyes_ClipEncoder.cpp, which runs the real RoboEyes drawing code and stores
+ * only the changed bytes of each frame, run-length encoded. The player copies them into the
+ * display buffer and sends the changed region, without any tweening or drawing on the board:
+ *
+ *   #include "boot_clip.h" // generated by the encoder
+ *   RoboEyes_ClipPlayer<RoboEyes_SSD1306> player(display);
+ *   setup(): player.play(bootClip);
+ *   loop():  if(player.isPlaying()){player.update();} else {roboEyes.update();}
+ *
+ * Works with displays whose memory is organized in pages of 8 pixel rows (Adafruit_SSD1306,
+ * RoboEyes_Framebuffer). Call roboEyes.forceFullRedraw() before drawing eyes after a clip.
+ *
+ * Clip format, all in flash memory (PROGMEM):
+ *   header: 'R' 'C' version(1) width pages frameInterval(ms) frameCount(16 bit, low byte first)
+ *   frame:  spans of changed bytes, then ROBOEYES_CLIP_END_FRAME
+ *   span:   page x0 length-1, then packets covering length bytes of the page, starting at column x0
+ *   packet: c < 0x80: c+1 literal bytes follow, c >= 0x80: the next byte repeated c-0x80+1 times
+ * The first frame is stored as change to a blank screen.
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_CLIP_H
+#define _FLUXGARAGE_ROBOEYES_CLIP_H
+
+#include "FluxGarage_RoboEyes.h"
+
+#define ROBOEYES_CLIP_VERSION 1
+#define ROBOEYES_CLIP_HEADER_SIZE 8
+#define ROBOEYES_CLIP_END_FRAME 0xFF
+#define ROBOEYES_CLIP_RUN 0x80 // packet flag for repeated bytes
+
+template <class Display>
+class RoboEyes_ClipPlayer
+{
+public:
+
+Display &display;
+const uint8_t *clip = 0; // clip playing, 0 = none
+const uint8_t *nextFrame = 0; // data of the next frame
+uint16_t frame = 0; // number of the next frame
+uint16_t frameCount = 0;
+byte frameInterval = 20; // milliseconds per frame, from the clip header
+unsigned long frameTime = 0; // time of the next frame
+bool looping = 0; // if true, start over after the last frame
+unsigned int bytesFlushed = 0; // bytes sent to the display in the last frame
+
+RoboEyes_ClipPlayer(Display &d) : display(d) {}
+
+// Start playing a clip. Returns false if it doesn't match the display size, or the display has no page buffer.
+bool play(const uint8_t *data, bool loop = false) {
+  clip = 0;
+  if(pgm_read_byte(data) != 'R' || pgm_read_byte(data+1) != 'C' || pgm_read_byte(data+2) != ROBOEYES_CLIP_VERSION){return false;}
+  if(pgm_read_byte(data+3) != display.width() || pgm_read_byte(data+4) != (display.height()+7)/8){return false;}
+  if(!roboEyesPageBuffer(display, &display)){return false;}
+  clip = data;
+  frameInterval = pgm_read_byte(data+5);
+  frameCount = pgm_read_byte(data+6) | (pgm_read_byte(data+7) << 8);
+  looping = loop;
+  frameTime = millis();
+  restart();
+  return frameCount > 0;
+}
+
+// Stop playing, the display keeps the last frame shown
+void stop() {
+  clip = 0;
+}
+
+// Returns true until the last frame has been shown (never for looping clips)
+bool isPlaying() {
+  return clip != 0;
+}
+
+// Call this in the main loop instead of roboEyes.update() while a clip is playing.
+// Shows the next frame when it's due, returns true if it did.
+bool update() {
+  if(!clip || (long)(millis()-frameTime) < 0){
+    return false;
+  }
+  frameTime += frameInterval;
+  bool first = (frame == 0);
+  if(first){
+    display.clearDisplay();
+  }
+  uint8_t *buffer = roboEyesPageBuffer(display, &display);
+  int16_t width = display.width();
+  byte x0 = 0xFF, x1 = 0, page0 = 0xFF, page1 = 0;
+  const uint8_t *data = nextFrame;
+  byte page;
+  while((page = pgm_read_byte(data++)) != ROBOEYES_CLIP_END_FRAME){
+    byte x = pgm_read_byte(data++);
+    int length = pgm_read_byte(data++) + 1;
+    if(x < x0){x0 = x;}
+    if(x+length-1 > x1){x1 = x+length-1;}
+    if(page < page0){page0 = page;}
+    if(page > page1){page1 = page;}
+    uint8_t *out = buffer + page*width + x;
+    while(length > 0){
+      byte packet = pgm_read_byte(data++);
+      byte count = (packet & 0x7F) + 1;
+      if(packet & ROBOEYES_CLIP_RUN){
+        memset(out, pgm_read_byte(data++), count);
+      } else {
+        for(byte i = 0; i < count; i++){out[i] = pgm_read_byte(data++);}
+      }
+      out += count;
+      length -= count;
+    }
+  }
+  nextFrame = data;
+  bytesFlushed = 0;
+  if(first){
+    bytesFlushed = roboEyesFlush(display, 0, width-1, 0, (display.height()+7)/8-1, 0); // replace whatever was on the screen
+  } else if(x0 != 0xFF){
+    bytesFlushed = roboEyesFlush(display, x0, x1, page0, page1, 0);
+  }
+  if(++frame >= frameCount){
+    if(looping){restart();} else {clip = 0;}
+  }
+  return true;
+}
+
+private:
+
+void restart() {
+  frame = 0;
+  nextFrame = clip + ROBOEYES_CLIP_HEADER_SIZE;
+}
+
+}; // end of class RoboEyes_ClipPlayer
+
+#endif
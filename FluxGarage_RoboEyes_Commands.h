@@ -0,0 +1,135 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Command queue for boards with several cores or an RTOS, e.g. ESP32: the eyes are drawn by
+ * a render task of their own, and other tasks (network, sensors) don't call the setters of
+ * RoboEyes, which would change the eyes while a frame is being drawn on the other core, but
+ * put commands into a RoboEyes_CommandQueue. The render task runs them between two frames.
+ *
+ *   RoboEyes_CommandQueue<32> commands;
+ *
+ *   render task:  for(;;){ roboEyes.runCommands(commands); roboEyes.update(); vTaskDelay(1); }
+ *   other tasks:  commands.setMood(HAPPY); commands.anim_laugh(); commands.setGaze(x, y);
+ *
+ * Any number of tasks can add commands at the same time, without locks: adding a command
+ * takes a few atomic operations, and never waits for the render task. If the queue is full,
+ * the command is dropped and the method returns false. Uses std::atomic, so it's meant for
+ * ESP32, RP2040 and desktop computers, not for AVR boards (which only have one core anyway).
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_COMMANDS_H
+#define _FLUXGARAGE_ROBOEYES_COMMANDS_H
+
+#include <stdint.h>
+#include <atomic>
+#include "FluxGarage_RoboEyes_Sequence.h"
+
+// Ring of SIZE commands (a power of 2), filled by any number of tasks and emptied by one render task.
+// Every slot carries a sequence number telling whether it's free for the producers or filled for
+// the consumer, so a producer only has to reserve a slot and publish it when written.
+template <unsigned int SIZE>
+class RoboEyes_CommandQueue
+{
+public:
+
+static_assert(SIZE >= 2 && (SIZE & (SIZE-1)) == 0, "RoboEyes_CommandQueue: SIZE must be a power of 2");
+static const unsigned int capacity = SIZE;
+
+struct Slot {
+  std::atomic<uint32_t> sequence; // = position: free for writing, = position+1: filled
+  RoboEyes_Command command;
+};
+
+Slot slots[SIZE];
+std::atomic<uint32_t> writePosition; // next position to reserve for writing, shared by all producers
+std::atomic<uint32_t> readPosition; // next position to read, only changed by the consumer
+std::atomic<uint32_t> dropped; // commands dropped because the queue was full
+
+RoboEyes_CommandQueue() : writePosition(0), readPosition(0), dropped(0) {
+  for(uint32_t i = 0; i < SIZE; i++){
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+// Add a command, from any task. Returns false if the queue is full.
+bool push(const RoboEyes_Command &command) {
+  uint32_t position = writePosition.load(std::memory_order_relaxed);
+  while(1){
+    Slot &slot = slots[position & (SIZE-1)];
+    int32_t state = (int32_t)(slot.sequence.load(std::memory_order_acquire) - position);
+    if(state == 0){
+      // Slot is free, reserve it unless another producer was faster
+      if(writePosition.compare_exchange_weak(position, position+1, std::memory_order_relaxed)){
+        slot.command = command;
+        slot.sequence.store(position+1, std::memory_order_release); // publish to the consumer
+        return true;
+      }
+    } else if(state < 0){
+      dropped.fetch_add(1, std::memory_order_relaxed); // slot not read yet, the queue is full
+      return false;
+    } else {
+      position = writePosition.load(std::memory_order_relaxed); // taken by another producer, try the next one
+    }
+  }
+}
+bool push(uint8_t op, uint8_t arg = 0, int16_t x = 0, int16_t y = 0) {
+  RoboEyes_Command command = {op, arg, x, y};
+  return push(command);
+}
+
+// Take the oldest command, only from the render task. Returns false if the queue is empty.
+bool pop(RoboEyes_Command &command) {
+  uint32_t position = readPosition.load(std::memory_order_relaxed);
+  Slot &slot = slots[position & (SIZE-1)];
+  if((int32_t)(slot.sequence.load(std::memory_order_acquire) - (position+1)) < 0){
+    return false; // not filled yet
+  }
+  command = slot.command;
+  slot.sequence.store(position+SIZE, std::memory_order_release); // free for the producers of the next round
+  readPosition.store(position+1, std::memory_order_relaxed);
+  return true;
+}
+
+// Returns true if there are no commands waiting, only exact when called from the render task
+bool empty() {
+  uint32_t position = readPosition.load(std::memory_order_relaxed);
+  return (int32_t)(slots[position & (SIZE-1)].sequence.load(std::memory_order_acquire) - (position+1)) < 0;
+}
+
+// Same names as the methods of RoboEyes, return false if the command was dropped
+bool open() { return push(ROBOEYES_OP_OPEN); }
+bool close() { return push(ROBOEYES_OP_CLOSE); }
+bool blink() { return push(ROBOEYES_OP_BLINK); }
+bool setMood(unsigned char mood) { return push(ROBOEYES_OP_MOOD, mood); }
+bool setPosition(unsigned char position) { return push(ROBOEYES_OP_POSITION, position); }
+bool setGaze(int16_t x, int16_t y) { return push(ROBOEYES_OP_GAZE, 0, x, y); }
+bool anim_laugh() { return push(ROBOEYES_OP_LAUGH); }
+bool anim_confused() { return push(ROBOEYES_OP_CONFUSED); }
+bool setAutoblinker(bool active) { return push(ROBOEYES_OP_AUTOBLINKER, active); }
+bool setIdleMode(bool active) { return push(ROBOEYES_OP_IDLE, active); }
+bool setCuriosity(bool curiousBit) { return push(ROBOEYES_OP_CURIOSITY, curiousBit); }
+bool setCyclops(bool cyclopsBit) { return push(ROBOEYES_OP_CYCLOPS, cyclopsBit); }
+bool setHFlicker(bool flickerBit, uint8_t amplitude) { return push(ROBOEYES_OP_HFLICKER, flickerBit ? amplitude : 0); }
+bool setVFlicker(bool flickerBit, uint8_t amplitude) { return push(ROBOEYES_OP_VFLICKER, flickerBit ? amplitude : 0); }
+
+}; // end of class RoboEyes_CommandQueue
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Expressions: eye shapes and mood as one record, usually kept in flash memory (PROGMEM),
+ * which RoboEyes::morphTo() turns into the targets of all animated parameters at once. The
+ * eyes then move from any expression to the next with the usual tweening, so adding an
+ * expression costs 9 bytes of flash and no code. Example:
+ *
+ *   const RoboEyes_Expression sulking PROGMEM = {
+ *     40, 40,   // width of left and right eye
+ *     20, 16,   // height of left and right eye
+ *     4, 4,     // border radius of left and right eye
+ *     6,        // space between the eyes, can be negative
+ *     ANGRY,    // mood: TIRED, ANGRY, HAPPY or DEFAULT
+ *     SW        // position: N, NE, E, SE, S, SW, W, NW, DEFAULT, or ROBOEYES_KEEP_POSITION
+ *   };
+ *   roboEyes.morphTo(&sulking);
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_EXPRESSION_H
+#define _FLUXGARAGE_ROBOEYES_EXPRESSION_H
+
+#include <stdint.h>
+
+// Position of an expression that leaves the eye position as it is
+#define ROBOEYES_KEEP_POSITION 0xFF
+
+struct RoboEyes_Expression {
+  uint8_t widthLeft; // in pixels
+  uint8_t widthRight;
+  uint8_t heightLeft;
+  uint8_t heightRight;
+  uint8_t borderRadiusLeft;
+  uint8_t borderRadiusRight;
+  int8_t spaceBetween;
+  uint8_t mood; // TIRED, ANGRY, HAPPY or DEFAULT
+  uint8_t position; // N, NE, E, SE, S, SW, W, NW, DEFAULT or ROBOEYES_KEEP_POSITION
+};
+
+// Expressions for 128x64 displays, only the ones used take up flash memory. This file is included
+// by FluxGarage_RoboEyes.h after the mood and position names are defined.
+static const RoboEyes_Expression roboEyesNeutral PROGMEM = {36, 36, 36, 36, 8, 8, 10, DEFAULT, ROBOEYES_KEEP_POSITION}; // the default shapes
+static const RoboEyes_Expression roboEyesSurprised PROGMEM = {30, 30, 44, 44, 15, 15, 14, DEFAULT, ROBOEYES_KEEP_POSITION}; // tall round eyes
+static const RoboEyes_Expression roboEyesSleepy PROGMEM = {40, 40, 20, 20, 4, 4, 8, TIRED, S}; // flat tired eyes looking down
+static const RoboEyes_Expression roboEyesSuspicious PROGMEM = {38, 30, 18, 24, 3, 3, 10, ANGRY, ROBOEYES_KEEP_POSITION}; // narrow angry eyes, one smaller
+static const RoboEyes_Expression roboEyesJoyful PROGMEM = {40, 40, 36, 36, 12, 12, 6, HAPPY, N}; // wide happy eyes looking up
+
+#endif
@@ -0,0 +1,204 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * In-memory monochrome frame buffer for RoboEyes, organized like the SSD1306 display
+ * memory (pages of 8 pixel rows, one byte per column and page). It offers the same
+ * drawing methods as the Adafruit GFX library and produces the same pixels, but without
+ * virtual functions and without any hardware, e.g. for running RoboEyes on a desktop
+ * computer or for sending the buffer to a display yourself.
+ *
+ * The shape algorithms follow the ones of the Adafruit GFX library (BSD license),
+ * Copyright (c) 2013 Adafruit Industries.
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_FRAMEBUFFER_H
+#define _FLUXGARAGE_ROBOEYES_FRAMEBUFFER_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Frame buffer of WIDTH x HEIGHT pixels, e.g. RoboEyes_Framebuffer<128, 64> display;
+template <int WIDTH, int HEIGHT>
+class RoboEyes_Framebuffer
+{
+public:
+
+uint8_t buffer[WIDTH*((HEIGHT+7)/8)]; // pages of 8 pixel rows, bit 0 = top row of a page
+unsigned long bytesSent = 0; // bytes that would have been sent to a display so far
+
+RoboEyes_Framebuffer() {
+  clearDisplay();
+}
+
+int16_t width() const { return WIDTH; }
+int16_t height() const { return HEIGHT; }
+uint8_t *getBuffer() { return buffer; }
+
+void clearDisplay() {
+  memset(buffer, 0, sizeof(buffer));
+}
+
+// There is no display attached, only count the bytes a display would receive
+void display() {
+  bytesSent += sizeof(buffer);
+}
+unsigned int displayRegion(int16_t x0, int16_t x1, uint8_t page0, uint8_t page1) {
+  unsigned int bytes = (x1-x0+1)*(page1-page0+1);
+  bytesSent += bytes;
+  return bytes;
+}
+
+// Returns the pixel at x, y
+bool getPixel(int16_t x, int16_t y) const {
+  if(x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT){return 0;}
+  return (buffer[x + (y/8)*WIDTH] >> (y&7)) & 1;
+}
+
+void drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if(x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT){return;}
+  if(color){
+    buffer[x + (y/8)*WIDTH] |= (1 << (y&7));
+  } else {
+    buffer[x + (y/8)*WIDTH] &= ~(1 << (y&7));
+  }
+}
+
+// Vertical line, clipped to the buffer. Writes whole bytes where the line covers a full page.
+void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if(x < 0 || x >= WIDTH){return;}
+  if(y < 0){h += y; y = 0;}
+  if(y+h > HEIGHT){h = HEIGHT-y;}
+  if(h <= 0){return;}
+  int16_t yEnd = y+h-1;
+  uint8_t *ptr = &buffer[x + (y/8)*WIDTH];
+  for(int16_t page = y/8; page <= yEnd/8; page++){
+    uint8_t mask = 0xFF;
+    if(page == y/8){mask &= 0xFF << (y&7);}
+    if(page == yEnd/8){mask &= 0xFF >> (7-(yEnd&7));}
+    if(color){*ptr |= mask;} else {*ptr &= ~mask;}
+    ptr += WIDTH;
+  }
+}
+
+// Horizontal line, clipped to the buffer
+void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if(y < 0 || y >= HEIGHT){return;}
+  if(x < 0){w += x; x = 0;}
+  if(x+w > WIDTH){w = WIDTH-x;}
+  if(w <= 0){return;}
+  uint8_t *ptr = &buffer[x + (y/8)*WIDTH];
+  uint8_t mask = 1 << (y&7);
+  if(color){
+    while(w--){*ptr++ |= mask;}
+  } else {
+    mask = ~mask;
+    while(w--){*ptr++ &= mask;}
+  }
+}
+
+void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for(int16_t i = x; i < x+w; i++){
+    drawFastVLine(i, y, h, color);
+  }
+}
+
+void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  int16_t maxRadius = ((w < h) ? w : h)/2; // 1/2 minor axis
+  if(r > maxRadius){r = maxRadius;}
+  fillRect(x+r, y, w-2*r, h, color);
+  fillCircleHelper(x+w-r-1, y+r, r, 1, h-2*r-1, color);
+  fillCircleHelper(x+r, y+r, r, 2, h-2*r-1, color);
+}
+
+// Quarter circle columns for fillRoundRect(), corners: 1 = right side, 2 = left side
+void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
+  int16_t f = 1-r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2*r;
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+  delta++;
+  while(x < y){
+    if(f >= 0){
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if(x < (y+1)){
+      if(corners & 1){drawFastVLine(x0+x, y0-y, 2*y+delta, color);}
+      if(corners & 2){drawFastVLine(x0-x, y0-y, 2*y+delta, color);}
+    }
+    if(y != py){
+      if(corners & 1){drawFastVLine(x0+py, y0-px, 2*px+delta, color);}
+      if(corners & 2){drawFastVLine(x0-py, y0-px, 2*px+delta, color);}
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  int16_t a, b, y, last, t;
+  // Sort coordinates by y order (y2 >= y1 >= y0)
+  if(y0 > y1){t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t;}
+  if(y1 > y2){t = y2; y2 = y1; y1 = t; t = x2; x2 = x1; x1 = t;}
+  if(y0 > y1){t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t;}
+  // All corners on the same line
+  if(y0 == y2){
+    a = b = x0;
+    if(x1 < a){a = x1;} else if(x1 > b){b = x1;}
+    if(x2 < a){a = x2;} else if(x2 > b){b = x2;}
+    drawFastHLine(a, y0, b-a+1, color);
+    return;
+  }
+  int16_t dx01 = x1-x0, dy01 = y1-y0, dx02 = x2-x0, dy02 = y2-y0, dx12 = x2-x1, dy12 = y2-y1;
+  int32_t sa = 0, sb = 0;
+  // Upper part: scanline crossings of edges 0-1 and 0-2, including line y1 for flat-bottomed triangles
+  if(y1 == y2){last = y1;} else {last = y1-1;}
+  for(y = y0; y <= last; y++){
+    a = x0 + sa/dy01;
+    b = x0 + sb/dy02;
+    sa += dx01;
+    sb += dx02;
+    if(a > b){t = a; a = b; b = t;}
+    drawFastHLine(a, y, b-a+1, color);
+  }
+  // Lower part: scanline crossings of edges 0-2 and 1-2, skipped for flat-bottomed triangles
+  sa = (int32_t)dx12*(y-y1);
+  sb = (int32_t)dx02*(y-y0);
+  for(; y <= y2; y++){
+    a = x1 + sa/dy12;
+    b = x0 + sb/dy02;
+    sa += dx12;
+    sb += dx02;
+    if(a > b){t = a; a = b; b = t;}
+    drawFastHLine(a, y, b-a+1, color);
+  }
+}
+
+}; // end of class RoboEyes_Framebuffer
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Replacements for the few Arduino core functions used by RoboEyes, so the library
+ * can be compiled and run on a desktop computer (e.g. Linux) without Arduino headers.
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_HOST_H
+#define _FLUXGARAGE_ROBOEYES_HOST_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <chrono>
+
+typedef uint8_t byte;
+
+// Simulated time in milliseconds, used instead of the real clock as long as simulation is enabled
+inline unsigned long &roboEyesHostSimulatedMillis() {
+  static unsigned long simulatedMillis = 0;
+  return simulatedMillis;
+}
+inline bool &roboEyesHostSimulation() {
+  static bool simulation = 0;
+  return simulation;
+}
+
+// Milliseconds since program start, or the simulated time if simulation is enabled
+inline unsigned long millis() {
+  if(roboEyesHostSimulation()){
+    return roboEyesHostSimulatedMillis();
+  }
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now()-start).count();
+}
+
+// Microseconds since program start, or the simulated time if simulation is enabled
+inline unsigned long micros() {
+  if(roboEyesHostSimulation()){
+    return roboEyesHostSimulatedMillis()*1000;
+  }
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now()-start).count();
+}
+
+// Random number from 0 to howBig-1, like Arduino's random()
+inline long random(long howBig) {
+  if(howBig <= 0){
+    return 0;
+  }
+  return rand() % howBig;
+}
+
+// Flash memory is ordinary memory on a desktop computer
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+inline uint8_t pgm_read_byte(const void *address) {
+  return *(const uint8_t *)address;
+}
+
+#endif
@@ -0,0 +1,174 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Per-frame instrumentation for RoboEyes. Only compiled in if ROBOEYES_PROFILING is
+ * defined before including FluxGarage_RoboEyes.h, otherwise it costs neither flash,
+ * RAM nor time:
+ *
+ *   #define ROBOEYES_PROFILING
+ *   #include <FluxGarage_RoboEyes.h>
+ *
+ * Each frame drawn by drawEyes() records the time spent in the sections tween
+ * (pre-calculations), macro (macro animations and eyelids), raster (drawing) and flush
+ * (sending to the display), as well as the pixels redrawn and the bytes sent. The
+ * last ROBOEYES_PROFILE_FRAMES frames are kept in a ring buffer.
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_PROFILER_H
+#define _FLUXGARAGE_ROBOEYES_PROFILER_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Number of frames kept in the ring buffer (max. 255)
+#ifndef ROBOEYES_PROFILE_FRAMES
+#define ROBOEYES_PROFILE_FRAMES 32
+#endif
+
+// Time source for the sections, e.g. #define ROBOEYES_PROFILE_CLOCK() ESP.getCycleCount() for CPU cycles on ESP32
+#ifndef ROBOEYES_PROFILE_CLOCK
+#define ROBOEYES_PROFILE_CLOCK() micros()
+#endif
+
+// Histogram bins: bin 0 counts values below 16, every further bin doubles the range, the last bin counts everything above
+#ifndef ROBOEYES_PROFILE_BINS
+#define ROBOEYES_PROFILE_BINS 8
+#endif
+
+// Channels recorded for each frame
+#define ROBOEYES_PROFILE_TWEEN 0 // pre-calculations and tweening
+#define ROBOEYES_PROFILE_MACRO 1 // macro animations, flicker and eyelids
+#define ROBOEYES_PROFILE_RASTER 2 // clearing and drawing
+#define ROBOEYES_PROFILE_FLUSH 3 // sending to the display
+#define ROBOEYES_PROFILE_TOTAL 4 // sum of all sections
+#define ROBOEYES_PROFILE_PIXELS 5 // pixels of the redrawn screen region
+#define ROBOEYES_PROFILE_BYTES 6 // bytes sent to the display
+#define ROBOEYES_PROFILE_CHANNELS 7
+
+#if ROBOEYES_PROFILE_FRAMES > 255
+#error "ROBOEYES_PROFILE_FRAMES must not exceed 255"
+#endif
+
+// Statistics of one channel over the frames in the ring buffer
+struct RoboEyes_ProfileStats
+{
+  uint16_t min;
+  uint16_t avg;
+  uint16_t max;
+  uint8_t histogram[ROBOEYES_PROFILE_BINS]; // number of frames per bin, see ROBOEYES_PROFILE_BINS
+};
+
+class RoboEyes_Profiler
+{
+public:
+
+uint16_t frames[ROBOEYES_PROFILE_FRAMES][ROBOEYES_PROFILE_CHANNELS]; // recorded frames, values saturate at 65535
+uint8_t head = 0; // position of the next frame to record
+uint8_t count = 0; // number of recorded frames
+uint16_t current[ROBOEYES_PROFILE_CHANNELS]; // frame being recorded
+unsigned long mark = 0; // clock value at the start of the current section
+
+// Start recording a frame
+void begin() {
+  memset(current, 0, sizeof(current));
+  mark = ROBOEYES_PROFILE_CLOCK();
+}
+
+// End the current section, the next one starts now
+void section(uint8_t channel) {
+  unsigned long now = ROBOEYES_PROFILE_CLOCK();
+  add(channel, now-mark);
+  add(ROBOEYES_PROFILE_TOTAL, now-mark);
+  mark = now;
+}
+
+// Finish the frame and store it in the ring buffer
+void end(unsigned long pixels, unsigned long bytes) {
+  add(ROBOEYES_PROFILE_PIXELS, pixels);
+  add(ROBOEYES_PROFILE_BYTES, bytes);
+  memcpy(frames[head], current, sizeof(current));
+  head = (head+1) % ROBOEYES_PROFILE_FRAMES;
+  if(count < ROBOEYES_PROFILE_FRAMES){count++;}
+}
+
+// Forget all recorded frames
+void clear() {
+  head = 0;
+  count = 0;
+}
+
+// Min, average, max and histogram of one channel over the recorded frames
+RoboEyes_ProfileStats stats(uint8_t channel) const {
+  RoboEyes_ProfileStats result;
+  memset(&result, 0, sizeof(result));
+  if(count == 0){return result;}
+  unsigned long sum = 0;
+  result.min = 0xFFFF;
+  for(uint8_t i = 0; i < count; i++){
+    uint16_t value = frames[i][channel];
+    if(value < result.min){result.min = value;}
+    if(value > result.max){result.max = value;}
+    sum += value;
+    result.histogram[histogramBin(value)]++;
+  }
+  result.avg = sum/count;
+  return result;
+}
+
+// Write the recorded frames, oldest first, to a Stream like Serial:
+// 'R' 'E' version channels frames, then per frame all channels as 16 bit little endian values
+template <class Output>
+void dump(Output &out) const {
+  out.write((uint8_t)'R');
+  out.write((uint8_t)'E');
+  out.write((uint8_t)1);
+  out.write((uint8_t)ROBOEYES_PROFILE_CHANNELS);
+  out.write((uint8_t)count);
+  uint8_t index = (head+ROBOEYES_PROFILE_FRAMES-count) % ROBOEYES_PROFILE_FRAMES;
+  for(uint8_t i = 0; i < count; i++){
+    for(uint8_t channel = 0; channel < ROBOEYES_PROFILE_CHANNELS; channel++){
+      out.write((uint8_t)(frames[index][channel] & 0xFF));
+      out.write((uint8_t)(frames[index][channel] >> 8));
+    }
+    index = (index+1) % ROBOEYES_PROFILE_FRAMES;
+  }
+}
+
+static uint8_t histogramBin(uint16_t value) {
+  uint8_t bin = 0;
+  value >>= 4;
+  while(value && bin < ROBOEYES_PROFILE_BINS-1){
+    value >>= 1;
+    bin++;
+  }
+  return bin;
+}
+
+private:
+
+void add(uint8_t channel, unsigned long value) {
+  unsigned long sum = current[channel] + value;
+  current[channel] = (sum > 0xFFFF) ? 0xFFFF : sum;
+}
+
+}; // end of class RoboEyes_Profiler
+
+#endif
@@ -0,0 +1,562 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Fast drawing of the eye shapes directly into a monochrome display buffer organized
+ * like the SSD1306 memory: pages of 8 pixel rows, one byte per column and page, bit 0
+ * being the top row of a page. Shapes are filled column by column, so a vertical run
+ * of pixels costs one masked byte store per page instead of one write per pixel.
+ * Results are pixel-identical to the Adafruit GFX fillRoundRect() and fillTriangle().
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_RASTER_H
+#define _FLUXGARAGE_ROBOEYES_RASTER_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Largest border radius with a precalculated corner table, the corners of larger radii are
+// calculated column by column while drawing (see cornerInset())
+#ifndef ROBOEYES_MAX_RADIUS
+#define ROBOEYES_MAX_RADIUS 32
+#endif
+
+// Number of corner tables kept in RoboEyes_CornerCache, each takes ROBOEYES_MAX_RADIUS bytes of RAM.
+// One frame uses up to 4 different radii (eyes and happy eyelids), so this is the minimum.
+#ifndef ROBOEYES_CORNER_CACHE_SIZE
+#define ROBOEYES_CORNER_CACHE_SIZE 4
+#endif
+#if ROBOEYES_CORNER_CACHE_SIZE < 4
+#error "ROBOEYES_CORNER_CACHE_SIZE must be at least 4"
+#endif
+
+// Marks a corner column that the circle algorithm doesn't draw
+#define ROBOEYES_NO_COLUMN 0xFF
+
+// Max. number of layers of one frame
+#define ROBOEYES_MAX_LAYERS 8
+
+// Layer types for the compositor
+#define ROBOEYES_LAYER_EYE 0 // rounded rectangle in main color
+#define ROBOEYES_LAYER_LID 1 // eyelid triangle cut out of the eyes (see fillLid())
+#define ROBOEYES_LAYER_CUTOUT 2 // rounded rectangle cut out of the eyes
+
+// One shape of the frame for compose(). Rounded rectangles use x, y, w, h and the corner
+// table inset of radius r (0 = no table, see cornerInset()), eyelids use x = xVertical,
+// w = xOther, y = yTop and h = lidHeight.
+struct RoboEyes_Layer {
+  uint8_t type;
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  uint8_t r;
+  const uint8_t *inset;
+};
+
+class RoboEyes_Raster
+{
+public:
+
+uint8_t *buffer; // display buffer
+int16_t width; // buffer width in pixels
+int16_t height; // buffer height in pixels
+int16_t clipX0; // pixels outside columns clipX0...clipX1 and rows clipY0...clipY1 are left as they are
+int16_t clipY0;
+int16_t clipX1;
+int16_t clipY1;
+
+RoboEyes_Raster(uint8_t *buf, int16_t w, int16_t h) : buffer(buf), width(w), height(h), clipX0(0), clipY0(0), clipX1(w-1), clipY1(h-1) {}
+
+// Only draw inside columns x0...x1 and rows y0...y1, e.g. the part of the screen showing the eyes
+void setClip(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  clipX0 = (x0 < 0) ? 0 : x0;
+  clipY0 = (y0 < 0) ? 0 : y0;
+  clipX1 = (x1 > width-1) ? width-1 : x1;
+  clipY1 = (y1 > height-1) ? height-1 : y1;
+}
+
+
+//*********************************************************************************************
+//  BASIC SPANS
+//*********************************************************************************************
+
+// Fill rows y0...y1 of column x, clipped
+void fillColumn(int16_t x, int16_t y0, int16_t y1, uint16_t color) {
+  if(x < clipX0 || x > clipX1){return;}
+  if(y0 < clipY0){y0 = clipY0;}
+  if(y1 > clipY1){y1 = clipY1;}
+  if(y1 < y0){return;}
+  uint8_t *ptr = buffer + (y0>>3)*width + x;
+  uint8_t mask = 0xFF << (y0&7);
+  int16_t pages = (y1>>3)-(y0>>3); // number of page boundaries crossed
+  if(color){
+    while(pages--){
+      *ptr |= mask;
+      ptr += width;
+      mask = 0xFF;
+    }
+    *ptr |= mask & (0xFF >> (7-(y1&7)));
+  } else {
+    while(pages--){
+      *ptr &= ~mask;
+      ptr += width;
+      mask = 0xFF;
+    }
+    *ptr &= ~(mask & (0xFF >> (7-(y1&7))));
+  }
+}
+
+// Fill columns x0...x1 of row y, clipped
+void fillRow(int16_t x0, int16_t x1, int16_t y, uint16_t color) {
+  if(y < clipY0 || y > clipY1){return;}
+  if(x0 < clipX0){x0 = clipX0;}
+  if(x1 > clipX1){x1 = clipX1;}
+  uint8_t *ptr = buffer + (y>>3)*width + x0;
+  uint8_t bit = 1 << (y&7);
+  for(int16_t x = x0; x <= x1; x++){
+    if(color){*ptr++ |= bit;} else {*ptr++ &= ~bit;}
+  }
+}
+
+// Clear columns x0...x1 of pages page0...page1 (one page = 8 pixel rows)
+void clearPages(int16_t x0, int16_t x1, int16_t page0, int16_t page1) {
+  if(x0 < 0){x0 = 0;}
+  if(x1 > width-1){x1 = width-1;}
+  if(x1 < x0){return;}
+  for(int16_t page = page0; page <= page1; page++){
+    memset(buffer + page*width + x0, 0, x1-x0+1);
+  }
+}
+
+void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for(int16_t i = x; i < x+w; i++){
+    fillColumn(i, y, y+h-1, color);
+  }
+}
+
+
+//*********************************************************************************************
+//  SHAPES
+//*********************************************************************************************
+
+// Calculate the corner table for border radius r: for the k-th column next to the straight
+// part of a rounded rectangle, inset[k-1] is the number of pixels left out at its top and
+// bottom, or ROBOEYES_NO_COLUMN. Same midpoint circle steps as Adafruit GFX fillCircleHelper().
+static void cornerInsets(uint8_t r, uint8_t *inset) {
+  memset(inset, ROBOEYES_NO_COLUMN, r);
+  int16_t f = 1-r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2*r;
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+  while(x < y){
+    if(f >= 0){
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if(x < (y+1)){
+      if(inset[x-1] == ROBOEYES_NO_COLUMN || r-y < inset[x-1]){inset[x-1] = r-y;}
+    }
+    if(y != py){
+      if(inset[py-1] == ROBOEYES_NO_COLUMN || r-px < inset[py-1]){inset[py-1] = r-px;}
+      py = y;
+    }
+    px = x;
+  }
+}
+
+// Integer square root, rounded down
+static uint32_t isqrt(uint32_t v) {
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+  while(bit > v){bit >>= 2;}
+  while(bit){
+    if(v >= root+bit){
+      v -= root+bit;
+      root = (root >> 1)+bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+// Row of the circle with radius r in column x of the first octant, as reached by the midpoint
+// circle steps: the largest y with (2y-1)^2 <= 4(r^2-x^2)
+static int16_t circleRow(uint8_t r, int16_t x) {
+  return (isqrt(4UL*((uint32_t)r*r-(uint32_t)x*x))+1)/2;
+}
+
+// Single entry inset[k-1] of the corner table for border radius r (see cornerInsets()), for radii
+// without a table. Column k reaches the circle row y of x = k while k <= y (first octant), or the
+// last column x whose row is k while x < k (second octant).
+static uint8_t cornerInset(uint8_t r, int16_t k) {
+  int16_t reach = -1;
+  int16_t y = circleRow(r, k);
+  if(k <= y){reach = y;}
+  int32_t v = 4L*r*r-(2L*k-1)*(2L*k-1);
+  if(v >= 0){
+    int16_t x = isqrt(v)/2;
+    if(x < k && x > reach && circleRow(r, x) == k){reach = x;}
+  }
+  return (reach < 0) ? ROBOEYES_NO_COLUMN : r-reach;
+}
+
+// Rounded rectangle with the corners taken from a table (see cornerInsets()), or calculated
+// column by column if inset is 0
+void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, const uint8_t *inset, uint16_t color) {
+  if(w <= 0 || h <= 0){return;}
+  // Straight middle part
+  for(int16_t cx = x+r; cx <= x+w-r-1; cx++){
+    fillColumn(cx, y, y+h-1, color);
+  }
+  // Rounded left and right parts
+  for(int16_t k = 1; k <= r; k++){
+    uint8_t i = inset ? inset[k-1] : cornerInset(r, k);
+    if(i == ROBOEYES_NO_COLUMN){continue;}
+    fillColumn(x+w-r-1+k, y+i, y+h-1-i, color);
+    fillColumn(x+r-k, y+i, y+h-1-i, color);
+  }
+}
+
+void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  if(w <= 0 || h <= 0){return;}
+  int16_t maxRadius = ((w < h) ? w : h)/2; // 1/2 minor axis
+  if(r > maxRadius){r = maxRadius;}
+  if(r > ROBOEYES_MAX_RADIUS){
+    fillRoundRect(x, y, w, h, r, 0, color);
+    return;
+  }
+  uint8_t inset[ROBOEYES_MAX_RADIUS];
+  cornerInsets(r, inset);
+  fillRoundRect(x, y, w, h, r, inset, color);
+}
+
+// Eyelid triangle: flat top edge from xVertical to xOther in row yTop, third corner
+// straight below xVertical in row yTop+lidHeight. Each column is covered from the
+// top down to where the sloped edge crosses it, so it is drawn as one column span.
+void fillLid(int16_t xVertical, int16_t xOther, int16_t yTop, int16_t lidHeight, uint16_t color) {
+  int16_t dx = xOther-xVertical;
+  int16_t step = (dx < 0) ? -1 : 1;
+  int16_t d = dx*step; // horizontal size
+  for(int16_t e = 0; e <= d; e++){
+    int16_t rows; // covered rows below yTop in column e (distance from xVertical)
+    if(lidHeight == 0 || d == 0){
+      rows = lidHeight;
+    } else {
+      // Last row whose sloped edge position floor(d*k/lidHeight) still reaches this column
+      rows = ((int32_t)lidHeight*(d-e+1)-1)/d;
+      if(rows > lidHeight){rows = lidHeight;}
+    }
+    fillColumn(xVertical+e*step, yTop, yTop+rows, color);
+  }
+}
+
+// Triangle like Adafruit GFX fillTriangle(). Eyelid shapes are drawn as columns via
+// fillLid(), any other triangle line by line.
+void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  int16_t a, b, y, last, t;
+  // Sort coordinates by y order (y2 >= y1 >= y0)
+  if(y0 > y1){t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t;}
+  if(y1 > y2){t = y2; y2 = y1; y1 = t; t = x2; x2 = x1; x1 = t;}
+  if(y0 > y1){t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t;}
+  // Eyelid: flat top, bottom corner below one of the top corners
+  if(y0 == y1 && x2 == x0){fillLid(x0, x1, y0, y2-y0, color); return;}
+  if(y0 == y1 && x2 == x1){fillLid(x1, x0, y0, y2-y0, color); return;}
+  // All corners on the same line
+  if(y0 == y2){
+    a = b = x0;
+    if(x1 < a){a = x1;} else if(x1 > b){b = x1;}
+    if(x2 < a){a = x2;} else if(x2 > b){b = x2;}
+    fillRow(a, b, y0, color);
+    return;
+  }
+  int16_t dx01 = x1-x0, dy01 = y1-y0, dx02 = x2-x0, dy02 = y2-y0, dx12 = x2-x1, dy12 = y2-y1;
+  int32_t sa = 0, sb = 0;
+  if(y1 == y2){last = y1;} else {last = y1-1;}
+  for(y = y0; y <= last; y++){
+    a = x0 + sa/dy01;
+    b = x0 + sb/dy02;
+    sa += dx01;
+    sb += dx02;
+    if(a > b){t = a; a = b; b = t;}
+    fillRow(a, b, y, color);
+  }
+  sa = (int32_t)dx12*(y-y1);
+  sb = (int32_t)dx02*(y-y0);
+  for(; y <= y2; y++){
+    a = x1 + sa/dy12;
+    b = x0 + sb/dy02;
+    sa += dx12;
+    sb += dx02;
+    if(a > b){t = a; a = b; b = t;}
+    fillRow(a, b, y, color);
+  }
+}
+
+
+
+//*********************************************************************************************
+//  COMPOSITOR
+//*********************************************************************************************
+
+// Returns a filled in layer for compose()
+static RoboEyes_Layer layer(uint8_t type, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, const uint8_t *inset) {
+  RoboEyes_Layer l;
+  l.type = type;
+  l.x = x;
+  l.y = y;
+  l.w = w;
+  l.h = h;
+  l.r = r;
+  l.inset = inset;
+  return l;
+}
+
+// Effective border radius of a rounded rectangle, like Adafruit GFX fillRoundRect() limits it
+static uint8_t roundRectRadius(int16_t w, int16_t h, int16_t r) {
+  int16_t maxRadius = ((w < h) ? w : h)/2;
+  if(r > maxRadius){r = maxRadius;}
+  if(r > 255){r = 255;}
+  return (r < 0) ? 0 : r;
+}
+
+// Rows top...bottom covered by a layer in column x, returns false if the column is not covered
+static bool columnSpan(const RoboEyes_Layer &layer, int16_t x, int16_t &top, int16_t &bottom) {
+  if(layer.type == ROBOEYES_LAYER_LID){
+    int16_t e = x-layer.x; // distance from the vertical edge
+    int16_t d = layer.w-layer.x; // horizontal size
+    if(d < 0){e = -e; d = -d;}
+    if(e < 0 || e > d){return 0;}
+    int16_t rows = layer.h;
+    if(rows != 0 && d != 0){
+      rows = ((int32_t)layer.h*(d-e+1)-1)/d;
+      if(rows > layer.h){rows = layer.h;}
+    }
+    top = layer.y;
+    bottom = layer.y+rows;
+    return 1;
+  }
+  // Rounded rectangle
+  if(layer.w <= 0 || layer.h <= 0 || x < layer.x || x >= layer.x+layer.w){return 0;}
+  int16_t k = 0; // distance from the straight middle part
+  if(x < layer.x+layer.r){k = layer.x+layer.r-x;}
+  else if(x > layer.x+layer.w-layer.r-1){k = x-(layer.x+layer.w-layer.r-1);}
+  uint8_t i = 0;
+  if(k > 0){
+    i = layer.inset ? layer.inset[k-1] : cornerInset(layer.r, k);
+    if(i == ROBOEYES_NO_COLUMN){return 0;}
+  }
+  top = layer.y+i;
+  bottom = layer.y+layer.h-1-i;
+  return top <= bottom;
+}
+
+// Bits of page (8 pixel rows) covered by rows top...bottom
+static uint8_t pageMask(int16_t top, int16_t bottom, int16_t page) {
+  int16_t y0 = page*8;
+  if(bottom < y0 || top > y0+7){return 0;}
+  uint8_t mask = 0xFF;
+  if(top > y0){mask &= 0xFF << (top-y0);}
+  if(bottom < y0+7){mask &= 0xFF >> (y0+7-bottom);}
+  return mask;
+}
+
+// Columns left...right and rows top...bottom a layer can cover, empty (left > right) if none
+static void layerExtent(const RoboEyes_Layer &layer, int16_t &left, int16_t &right, int16_t &top, int16_t &bottom) {
+  if(layer.type == ROBOEYES_LAYER_LID){
+    left = (layer.x < layer.w) ? layer.x : layer.w;
+    right = (layer.x < layer.w) ? layer.w : layer.x;
+    top = layer.y;
+    bottom = layer.y+layer.h;
+  } else {
+    left = layer.x;
+    right = (layer.h > 0) ? layer.x+layer.w-1 : layer.x-1;
+    top = layer.y;
+    bottom = layer.y+layer.h-1;
+  }
+}
+
+// Bits of the 32 rows band...band+31 covered by rows top...bottom, bit 0 = row band
+static uint32_t rowMask(int16_t top, int16_t bottom, int16_t band) {
+  if(top < band){top = band;}
+  if(bottom > band+31){bottom = band+31;}
+  if(bottom < top){return 0;}
+  uint32_t span = (bottom-top == 31) ? 0xFFFFFFFF : ((uint32_t)1 << (bottom-top+1))-1;
+  return span << (top-band);
+}
+
+// Draw a whole frame region in one pass: each byte of columns x0...x1 in pages page0...page1
+// is written once, with the pixels inside any eye layer and outside all cutting layers set
+// and all others cleared, with the same column spans as fillRoundRect() and fillLid(). The
+// region doesn't need to be cleared before. Rows outside the clip rows keep their pixels.
+void compose(int16_t x0, int16_t x1, int16_t page0, int16_t page1, const RoboEyes_Layer *layers, uint8_t count) {
+  if(x0 < clipX0){x0 = clipX0;}
+  if(x1 > clipX1){x1 = clipX1;}
+  int16_t y0 = (page0*8 < clipY0) ? clipY0 : page0*8;
+  int16_t y1 = (page1*8+7 > clipY1) ? clipY1 : page1*8+7;
+  if(x0 > x1 || y0 > y1){return;}
+  // Eye layers reaching into the region (used 0...eyes-1), then the cutting layers reaching
+  // into one of them (used eyes...usedCount-1), with the columns and rows they can cover
+  uint8_t used[ROBOEYES_MAX_LAYERS];
+  int16_t left[ROBOEYES_MAX_LAYERS];
+  int16_t right[ROBOEYES_MAX_LAYERS];
+  int16_t top[ROBOEYES_MAX_LAYERS];
+  int16_t bottom[ROBOEYES_MAX_LAYERS];
+  uint8_t usedCount = 0;
+  uint8_t eyes = 0;
+  int16_t shapeX0 = x1+1; // columns reached by the eye layers
+  int16_t shapeX1 = x0-1;
+  for(uint8_t pass = 0; pass < 2; pass++){
+    for(uint8_t l = 0; l < count && usedCount < ROBOEYES_MAX_LAYERS; l++){
+      if((layers[l].type == ROBOEYES_LAYER_EYE) != (pass == 0)){continue;}
+      uint8_t u = usedCount;
+      layerExtent(layers[l], left[u], right[u], top[u], bottom[u]);
+      if(right[u] < x0 || left[u] > x1 || bottom[u] < y0 || top[u] > y1 || right[u] < left[u] || bottom[u] < top[u]){continue;}
+      bool overlap = (pass == 0);
+      for(uint8_t e = 0; e < eyes; e++){
+        if(right[u] >= left[e] && left[u] <= right[e] && bottom[u] >= top[e] && top[u] <= bottom[e]){overlap = 1;}
+      }
+      if(!overlap){continue;}
+      if(pass == 0){
+        if(left[u] < shapeX0){shapeX0 = (left[u] < x0) ? x0 : left[u];}
+        if(right[u] > shapeX1){shapeX1 = (right[u] > x1) ? x1 : right[u];}
+      }
+      used[usedCount++] = l;
+    }
+    if(pass == 0){eyes = usedCount;}
+  }
+  // Columns without eyes are only cleared
+  for(int16_t page = y0>>3; page <= (y1>>3); page++){
+    uint8_t keep = ~pageMask(y0, y1, page);
+    uint8_t *ptr = buffer + page*width;
+    for(int16_t x = x0; x <= x1; x++){
+      if(x == shapeX0){x = shapeX1; continue;}
+      ptr[x] &= keep;
+    }
+  }
+  for(int16_t x = shapeX0; x <= shapeX1; x++){
+    // Rows covered by the layers in this column, eyes first
+    int16_t spanTop[ROBOEYES_MAX_LAYERS];
+    int16_t spanBottom[ROBOEYES_MAX_LAYERS];
+    uint8_t spans = 0;
+    uint8_t eyeSpans = 0;
+    for(uint8_t u = 0; u < usedCount; u++){
+      if(u == eyes){
+        if(spans == 0){break;} // nothing to cut
+        eyeSpans = spans;
+      }
+      if(x < left[u] || x > right[u]){continue;}
+      if(columnSpan(layers[used[u]], x, spanTop[spans], spanBottom[spans])){spans++;}
+    }
+    if(eyes == usedCount){eyeSpans = spans;}
+    // 32 rows (4 pages) at a time: rows covered by eye layers and not by cutting layers, one bit per row
+    uint8_t *ptr = buffer + (y0>>3)*width + x;
+    for(int16_t band = y0 & ~7; band <= y1; band += 32){
+      uint32_t visible = 0;
+      for(uint8_t i = 0; i < eyeSpans; i++){
+        visible |= rowMask(spanTop[i], spanBottom[i], band);
+      }
+      for(uint8_t i = eyeSpans; visible && i < spans; i++){
+        visible &= ~rowMask(spanTop[i], spanBottom[i], band);
+      }
+      uint32_t region = rowMask(y0, y1, band);
+      for(int16_t row = band; row <= y1 && row < band+32; row += 8){
+        uint8_t keep = ~region; // pixels outside the region in this page
+        *ptr = (*ptr & keep) | ((uint8_t)visible & ~keep);
+        ptr += width;
+        visible >>= 8;
+        region >>= 8;
+      }
+    }
+  }
+}
+
+}; // end of class RoboEyes_Raster
+
+
+// Displays without a page buffer that draw the layers of a frame themselves, e.g. band by
+// band into a small strip buffer (see FluxGarage_RoboEyes_TFT.h). RoboEyes hands them the
+// layers in flush() instead of drawing.
+class RoboEyes_LayerDisplay
+{
+public:
+
+virtual ~RoboEyes_LayerDisplay() {}
+
+// Draw and send rows y0...y1 of columns x0...x1 with the pixels inside any eye layer and outside
+// all cutting layers in eye color, all others in background color. Returns the number of bytes sent.
+virtual unsigned long drawLayers(const RoboEyes_Layer *layers, uint8_t count, int16_t x0, int16_t x1, int16_t y0, int16_t y1) = 0;
+
+}; // end of class RoboEyes_LayerDisplay
+
+
+// Keeps the corner tables of the most recently used border radii, so that frames with
+// unchanged eye shapes don't have to recalculate them. The table only depends on the
+// effective radius: width and height of a rounded rectangle just limit it (see roundRectRadius()).
+class RoboEyes_CornerCache
+{
+public:
+
+uint8_t radius[ROBOEYES_CORNER_CACHE_SIZE]; // radius of each table, ROBOEYES_NO_COLUMN = unused
+uint8_t order[ROBOEYES_CORNER_CACHE_SIZE]; // table numbers, most recently used first
+uint8_t inset[ROBOEYES_CORNER_CACHE_SIZE][ROBOEYES_MAX_RADIUS];
+unsigned long hits = 0; // lookups answered from the cache
+unsigned long misses = 0; // lookups that had to calculate a table
+
+RoboEyes_CornerCache() {
+  for(uint8_t i = 0; i < ROBOEYES_CORNER_CACHE_SIZE; i++){
+    radius[i] = ROBOEYES_NO_COLUMN;
+    order[i] = i;
+  }
+}
+
+// Returns the corner table for effective radius r (see RoboEyes_Raster::cornerInsets()), or 0
+// for radii above ROBOEYES_MAX_RADIUS, whose corners are calculated while drawing
+const uint8_t *get(uint8_t r) {
+  if(r > ROBOEYES_MAX_RADIUS){return 0;}
+  uint8_t pos = 0;
+  while(pos < ROBOEYES_CORNER_CACHE_SIZE-1 && radius[order[pos]] != r){pos++;}
+  uint8_t slot = order[pos];
+  if(radius[slot] == r){
+    hits++;
+  } else {
+    // Not found, replace the least recently used table (last position)
+    misses++;
+    radius[slot] = r;
+    RoboEyes_Raster::cornerInsets(r, inset[slot]);
+  }
+  // Move to the front
+  for(; pos > 0; pos--){order[pos] = order[pos-1];}
+  order[0] = slot;
+  return inset[slot];
+}
+
+}; // end of class RoboEyes_CornerCache
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * SSD1306 display class with partial screen updates. Instead of pushing the whole
+ * frame buffer to the display, only a window of columns and pages is transmitted.
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_SSD1306_H
+#define _FLUXGARAGE_ROBOEYES_SSD1306_H
+
+#include <Adafruit_SSD1306.h>
+#include "FluxGarage_RoboEyes_Transport.h"
+
+// Max. bytes per I2C transmission, including the leading control byte (AVR Wire buffer is 32 bytes)
+#ifndef ROBOEYES_WIRE_MAX
+#define ROBOEYES_WIRE_MAX 32
+#endif
+
+// Use this class instead of Adafruit_SSD1306 when declaring the display in your sketch.
+// RoboEyes detects displayRegion() and then only sends the part of the screen that changed.
+class RoboEyes_SSD1306 : public Adafruit_SSD1306
+{
+public:
+
+using Adafruit_SSD1306::Adafruit_SSD1306; // same constructors as Adafruit_SSD1306
+
+// Send columns x0...x1 of pages page0...page1 (one page = 8 pixel rows) to the display.
+// Returns the number of bytes put on the bus. Only I2C is transmitted partially,
+// SPI displays are fast enough and get the whole frame via display(). So do rotated
+// displays, whose region in the buffer is not the one RoboEyes drew.
+unsigned int displayRegion(int16_t x0, int16_t x1, uint8_t page0, uint8_t page1) {
+  if(!wire || getRotation() != 0){
+    display();
+    return WIDTH*((HEIGHT+7)/8);
+  }
+  unsigned int bytesSent = setWindow(x0, x1, page0, page1);
+  // Send window contents page by page
+  for(uint8_t page = page0; page <= page1; page++){
+    const uint8_t *ptr = buffer + page*WIDTH + x0;
+    uint8_t count = x1-x0+1;
+    while(count){
+      uint8_t chunk = (count < ROBOEYES_WIRE_MAX-1) ? count : ROBOEYES_WIRE_MAX-1;
+      bytesSent += sendData(ptr, chunk);
+      ptr += chunk;
+      count -= chunk;
+    }
+  }
+  return bytesSent;
+}
+
+// Set the address window for the following data, the display wraps to the next page after column x1.
+// Returns the number of bytes put on the bus.
+unsigned int setWindow(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) {
+  uint8_t offset = (WIDTH == 64 && HEIGHT == 48) ? 32 : 0; // 64x48 panels show controller columns 32...95, like in display()
+#if ARDUINO >= 157
+  wire->setClock(wireClk);
+#endif
+  ssd1306_command1(SSD1306_PAGEADDR);
+  ssd1306_command1(page0);
+  ssd1306_command1(page1);
+  ssd1306_command1(SSD1306_COLUMNADDR);
+  ssd1306_command1(x0+offset);
+  ssd1306_command1(x1+offset);
+#if ARDUINO >= 157
+  wire->setClock(restoreClk);
+#endif
+  return 6*2; // each command is preceded by a control byte
+}
+
+// Send up to ROBOEYES_WIRE_MAX-1 bytes of display data in one I2C transmission, returns the number of bytes put on the bus
+unsigned int sendData(const uint8_t *data, uint8_t count) {
+#if ARDUINO >= 157
+  wire->setClock(wireClk);
+#endif
+  wire->beginTransmission(i2caddr);
+  wire->write((uint8_t)0x40); // control byte: data follows
+  for(uint8_t i = 0; i < count; i++){
+    wire->write(data[i]);
+  }
+  wire->endTransmission();
+#if ARDUINO >= 157
+  wire->setClock(restoreClk);
+#endif
+  return count+1;
+}
+
+// Returns true for displays on I2C
+bool isI2C() const {
+  return wire != 0;
+}
+
+}; // end of class RoboEyes_SSD1306
+
+
+// Transport for RoboEyes::setAsyncFlush() that sends one I2C transmission (max. ROBOEYES_WIRE_MAX bytes)
+// per call of RoboEyes::update(), so the main loop never waits for a whole frame to be transmitted:
+//   RoboEyes_SSD1306Transport transport(display);
+//   uint8_t frontBuffer[SCREEN_WIDTH*SCREEN_HEIGHT/8];
+//   roboEyes.setAsyncFlush(&transport, frontBuffer);
+// SPI and rotated displays are sent completely by display() right away.
+class RoboEyes_SSD1306Transport : public RoboEyes_Transport
+{
+public:
+
+RoboEyes_SSD1306 &display;
+const uint8_t *buffer = 0; // front buffer being sent
+int16_t width = 0;
+uint8_t x0 = 0; // window being sent
+uint8_t x1 = 0;
+uint8_t page1 = 0;
+uint8_t x = 0; // next column and page to send
+uint8_t page = 0;
+bool active = 0; // true while a transfer is running
+unsigned long bytesSent = 0; // bytes put on the bus so far
+
+RoboEyes_SSD1306Transport(RoboEyes_SSD1306 &d) : display(d) {}
+
+void send(const uint8_t *data, int16_t dataWidth, int16_t windowX0, int16_t windowX1, uint8_t windowPage0, uint8_t windowPage1) {
+  if(!display.isI2C() || display.getRotation() != 0){
+    display.display(); // display buffer is identical to the front buffer right after RoboEyes copied the region
+    return;
+  }
+  buffer = data;
+  width = dataWidth;
+  x0 = windowX0;
+  x1 = windowX1;
+  page1 = windowPage1;
+  x = windowX0;
+  page = windowPage0;
+  bytesSent += display.setWindow(windowX0, windowX1, windowPage0, windowPage1);
+  active = 1;
+}
+
+bool busy() {
+  return active;
+}
+
+// Send the next chunk of the current page
+void poll() {
+  if(!active){return;}
+  uint8_t count = x1-x+1;
+  if(count > ROBOEYES_WIRE_MAX-1){count = ROBOEYES_WIRE_MAX-1;}
+  bytesSent += display.sendData(buffer + page*width + x, count);
+  x += count;
+  if(x > x1 || x == 0){
+    x = x0;
+    if(page++ == page1){active = 0;}
+  }
+}
+
+}; // end of class RoboEyes_SSD1306Transport
+
+#endif
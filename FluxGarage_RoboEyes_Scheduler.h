@@ -0,0 +1,205 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Scheduler for several RoboEyes instances on several displays, e.g. behind an I2C
+ * multiplexer. Instead of drawing and sending one display after the other, every call
+ * of update() renders all displays whose frame is due into their buffers, and then sends
+ * only one display: the one with the most changed bytes waiting. Displays that had to
+ * wait gain priority, so no display is starved. Each call stays short, and rendering of
+ * one display happens between the transmissions of the others.
+ *
+ *   RoboEyes<RoboEyes_SSD1306> eyes(display1);
+ *   RoboEyes<RoboEyes_SSD1306> face(display2);
+ *   RoboEyes_Scheduler scheduler;
+ *
+ *   void selectChannel(byte channel) { // e.g. for a TCA9548A multiplexer at address 0x70
+ *     Wire.beginTransmission(0x70);
+ *     Wire.write(1 << channel);
+ *     Wire.endTransmission();
+ *   }
+ *
+ *   setup(): scheduler.setSelect(selectChannel);
+ *            selectChannel(0); eyes.begin(...); scheduler.add(eyes, 0);
+ *            selectChannel(1); face.begin(...); scheduler.add(face, 1);
+ *   loop():  scheduler.update();
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_SCHEDULER_H
+#define _FLUXGARAGE_ROBOEYES_SCHEDULER_H
+
+#include "FluxGarage_RoboEyes.h"
+
+// Max. number of RoboEyes instances per scheduler
+#ifndef ROBOEYES_MAX_DISPLAYS
+#define ROBOEYES_MAX_DISPLAYS 4
+#endif
+
+// Priority gain in bytes for each update() a display has been waiting to be sent
+#ifndef ROBOEYES_SCHEDULER_AGING
+#define ROBOEYES_SCHEDULER_AGING 256
+#endif
+
+#define ROBOEYES_NO_CHANNEL 0xFF
+
+class RoboEyes_Scheduler
+{
+public:
+
+// One RoboEyes instance, accessed through functions for its display type
+struct Entry {
+  void *eyes;
+  bool (*render)(void *eyes, unsigned long &renderTime); // render if a frame is due, returns true if there's something to send
+  unsigned long (*flush)(void *eyes, unsigned long renderTime); // send and finish frame statistics
+  unsigned int (*pendingBytes)(void *eyes);
+  void (*stagger)(void *eyes, byte position, byte count); // move the next frame deadline to position/count of a frame interval from now
+  unsigned long (*untilWork)(void *eyes); // see RoboEyes::msUntilNextWork()
+  byte channel; // multiplexer channel of the display
+  byte waiting; // number of update() calls the rendered frame has been waiting to be sent
+  unsigned long renderTime; // microseconds for rendering the waiting frame
+};
+
+Entry entries[ROBOEYES_MAX_DISPLAYS];
+byte count = 0; // number of instances
+void (*select)(byte channel) = 0; // called before sending to a display on another multiplexer channel
+byte selectedChannel = ROBOEYES_NO_CHANNEL; // channel selected last
+unsigned long bytesFlushed = 0; // bytes sent to all displays so far
+
+// Add a RoboEyes instance, call its begin() before. Returns false if there are ROBOEYES_MAX_DISPLAYS already.
+// The frame deadlines of all instances are spread over one frame interval, so they don't all render and send at once.
+template <class Display>
+bool add(RoboEyes<Display> &eyes, byte channel = ROBOEYES_NO_CHANNEL) {
+  if(count >= ROBOEYES_MAX_DISPLAYS){return false;}
+  Entry &entry = entries[count++];
+  entry.eyes = &eyes;
+  entry.render = &renderEyes<Display>;
+  entry.flush = &flushEyes<Display>;
+  entry.pendingBytes = &pendingEyes<Display>;
+  entry.stagger = &staggerEyes<Display>;
+  entry.untilWork = &untilWorkEyes<Display>;
+  entry.channel = channel;
+  entry.waiting = 0;
+  entry.renderTime = 0;
+  for(byte i = 0; i < count; i++){
+    entries[i].stagger(entries[i].eyes, i, count);
+  }
+  return true;
+}
+
+// Set the function selecting a multiplexer channel, e.g. void selectChannel(byte channel)
+void setSelect(void (*selectFunction)(byte channel)) {
+  select = selectFunction;
+  selectedChannel = ROBOEYES_NO_CHANNEL;
+}
+
+// Call this in the main loop instead of update() of the single instances
+void update() {
+  // Render every display whose frame is due and that has no frame waiting to be sent
+  for(byte i = 0; i < count; i++){
+    Entry &entry = entries[i];
+    if(entry.pendingBytes(entry.eyes) == 0){
+      entry.waiting = 0;
+      entry.render(entry.eyes, entry.renderTime);
+    }
+  }
+  // Send the display with the most visible change, taking the waiting time into account
+  byte next = ROBOEYES_NO_CHANNEL;
+  unsigned long best = 0;
+  for(byte i = 0; i < count; i++){
+    unsigned int bytes = entries[i].pendingBytes(entries[i].eyes);
+    if(bytes == 0){continue;}
+    unsigned long priority = bytes + (unsigned long)entries[i].waiting*ROBOEYES_SCHEDULER_AGING;
+    if(next == ROBOEYES_NO_CHANNEL || priority > best){
+      next = i;
+      best = priority;
+    }
+  }
+  if(next == ROBOEYES_NO_CHANNEL){return;}
+  for(byte i = 0; i < count; i++){
+    if(i != next && entries[i].pendingBytes(entries[i].eyes) && entries[i].waiting < 255){entries[i].waiting++;}
+  }
+  Entry &entry = entries[next];
+  if(select && entry.channel != ROBOEYES_NO_CHANNEL && entry.channel != selectedChannel){
+    select(entry.channel);
+    selectedChannel = entry.channel;
+  }
+  bytesFlushed += entry.flush(entry.eyes, entry.renderTime);
+  entry.waiting = 0;
+}
+
+// Returns the milliseconds until update() has something to do for any of the displays,
+// ROBOEYES_NO_WORK if none of them has anything to do until a setter is called
+unsigned long msUntilNextWork() {
+  unsigned long next = ROBOEYES_NO_WORK;
+  for(byte i = 0; i < count; i++){
+    if(entries[i].pendingBytes(entries[i].eyes)){return 0;} // frame waiting to be sent
+    unsigned long wait = entries[i].untilWork(entries[i].eyes);
+    if(wait < next){next = wait;}
+  }
+  return next;
+}
+
+private:
+
+template <class Display>
+static bool renderEyes(void *eyes, unsigned long &renderTime) {
+  RoboEyes<Display> &e = *(RoboEyes<Display> *)eyes;
+  unsigned long now = e.currentTime();
+#if ROBOEYES_HAS(SEQUENCER)
+  e.updateSequence(now);
+#endif
+  if(!e.frameDue(now)){return false;}
+  unsigned long start = micros();
+  e.render(e.fpsTimer);
+  renderTime = micros()-start;
+  if(!e.flushPending){
+    e.measureFrame(e.fpsTimer, renderTime); // nothing to send, frame is complete
+  }
+  return e.flushPending;
+}
+
+template <class Display>
+static unsigned long flushEyes(void *eyes, unsigned long renderTime) {
+  RoboEyes<Display> &e = *(RoboEyes<Display> *)eyes;
+  unsigned long start = micros();
+  unsigned long bytes = e.flush();
+  e.measureFrame(e.fpsTimer, renderTime + micros()-start);
+  return bytes;
+}
+
+template <class Display>
+static unsigned int pendingEyes(void *eyes) {
+  return ((RoboEyes<Display> *)eyes)->pendingBytes();
+}
+
+template <class Display>
+static void staggerEyes(void *eyes, byte position, byte count) {
+  RoboEyes<Display> &e = *(RoboEyes<Display> *)eyes;
+  e.nextFrameTime = e.currentTime() + (unsigned long)position*e.frameInterval/count;
+}
+
+template <class Display>
+static unsigned long untilWorkEyes(void *eyes) {
+  return ((RoboEyes<Display> *)eyes)->msUntilNextWork();
+}
+
+}; // end of class RoboEyes_Scheduler
+
+#endif
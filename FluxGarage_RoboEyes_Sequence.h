@@ -0,0 +1,94 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Instructions for animation sequences played by RoboEyes::playSequence(). A sequence is
+ * a byte array, usually kept in flash memory (PROGMEM), and is run by update(): while a
+ * sequence waits, each update() only compares one timestamp, so even long sequences cost
+ * almost no RAM or time. Example:
+ *
+ *   const uint8_t sequence[] PROGMEM = {
+ *     SEQ_CLOSE,
+ *     SEQ_MARK,                     // start of the looped part
+ *     SEQ_WAIT(2000), SEQ_OPEN,
+ *     SEQ_WAIT(2000), SEQ_MOOD(HAPPY), SEQ_LAUGH,
+ *     SEQ_WAIT(2000), SEQ_MOOD(TIRED),
+ *     SEQ_WAIT(2000), SEQ_CLOSE, SEQ_MOOD(DEFAULT),
+ *     SEQ_LOOP(0)                   // repeat from SEQ_MARK forever
+ *   };
+ *   setup(): roboEyes.playSequence(sequence);
+ *
+ * Instructions for features removed with ROBOEYES_FEATURES are skipped.
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_SEQUENCE_H
+#define _FLUXGARAGE_ROBOEYES_SEQUENCE_H
+
+#include <stdint.h>
+
+// Operation codes, followed by the number of argument bytes given in brackets
+#define ROBOEYES_OP_END 0 // [0] end of the sequence
+#define ROBOEYES_OP_WAIT 1 // [2] wait milliseconds (16 bit, low byte first) after the previous wait ended
+#define ROBOEYES_OP_MARK 2 // [0] start of the part repeated by ROBOEYES_OP_LOOP
+#define ROBOEYES_OP_LOOP 3 // [1] play the part since the mark this many times in total, 0 = forever
+#define ROBOEYES_OP_OPEN 4 // [0]
+#define ROBOEYES_OP_CLOSE 5 // [0]
+#define ROBOEYES_OP_BLINK 6 // [0]
+#define ROBOEYES_OP_MOOD 7 // [1] TIRED, ANGRY, HAPPY or DEFAULT
+#define ROBOEYES_OP_POSITION 8 // [1] N, NE, E, SE, S, SW, W, NW or DEFAULT
+#define ROBOEYES_OP_LAUGH 9 // [0]
+#define ROBOEYES_OP_CONFUSED 10 // [0]
+#define ROBOEYES_OP_AUTOBLINKER 11 // [1] ON or OFF
+#define ROBOEYES_OP_IDLE 12 // [1] ON or OFF
+#define ROBOEYES_OP_CURIOSITY 13 // [1] ON or OFF
+#define ROBOEYES_OP_CYCLOPS 14 // [1] ON or OFF
+#define ROBOEYES_OP_HFLICKER 15 // [1] amplitude in pixels, 0 = off
+#define ROBOEYES_OP_VFLICKER 16 // [1] amplitude in pixels, 0 = off
+#define ROBOEYES_OP_GAZE 17 // [4] x and y (16 bit each, low byte first), see RoboEyes::setGaze()
+
+// Instructions for writing sequences
+#define SEQ_END ROBOEYES_OP_END
+#define SEQ_WAIT(ms) ROBOEYES_OP_WAIT, (uint8_t)((ms) & 0xFF), (uint8_t)(((ms) >> 8) & 0xFF)
+#define SEQ_MARK ROBOEYES_OP_MARK
+#define SEQ_LOOP(count) ROBOEYES_OP_LOOP, (uint8_t)(count)
+#define SEQ_OPEN ROBOEYES_OP_OPEN
+#define SEQ_CLOSE ROBOEYES_OP_CLOSE
+#define SEQ_BLINK ROBOEYES_OP_BLINK
+#define SEQ_MOOD(mood) ROBOEYES_OP_MOOD, (uint8_t)(mood)
+#define SEQ_POSITION(position) ROBOEYES_OP_POSITION, (uint8_t)(position)
+#define SEQ_LAUGH ROBOEYES_OP_LAUGH
+#define SEQ_CONFUSED ROBOEYES_OP_CONFUSED
+#define SEQ_AUTOBLINKER(active) ROBOEYES_OP_AUTOBLINKER, (uint8_t)(active)
+#define SEQ_IDLE(active) ROBOEYES_OP_IDLE, (uint8_t)(active)
+#define SEQ_CURIOSITY(active) ROBOEYES_OP_CURIOSITY, (uint8_t)(active)
+#define SEQ_CYCLOPS(active) ROBOEYES_OP_CYCLOPS, (uint8_t)(active)
+#define SEQ_HFLICKER(amplitude) ROBOEYES_OP_HFLICKER, (uint8_t)(amplitude)
+#define SEQ_VFLICKER(amplitude) ROBOEYES_OP_VFLICKER, (uint8_t)(amplitude)
+#define SEQ_GAZE(x, y) ROBOEYES_OP_GAZE, (uint8_t)((x) & 0xFF), (uint8_t)(((x) >> 8) & 0xFF), (uint8_t)((y) & 0xFF), (uint8_t)(((y) >> 8) & 0xFF)
+
+// One instruction, as run by RoboEyes::runCommand(), e.g. from a RoboEyes_CommandQueue
+struct RoboEyes_Command {
+  uint8_t op; // ROBOEYES_OP_ code, but no END, WAIT, MARK or LOOP
+  uint8_t arg; // argument of instructions with one byte
+  int16_t x; // arguments of ROBOEYES_OP_GAZE
+  int16_t y;
+};
+
+#endif
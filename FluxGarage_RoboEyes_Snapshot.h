@@ -0,0 +1,140 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * State snapshots: RoboEyes::saveState() writes the whole state of the eyes (shapes, mood,
+ * positions, animations and their timers) into ROBOEYES_SNAPSHOT_SIZE bytes, which can be kept
+ * in EEPROM or in memory surviving deep sleep. Passed to begin(), the eyes start again with
+ * the expression they had, instead of opening from closed eyes:
+ *
+ *   RTC_DATA_ATTR uint8_t snapshot[ROBOEYES_SNAPSHOT_SIZE]; // ESP32, kept during deep sleep
+ *
+ *   setup():          roboEyes.begin(SCREEN_WIDTH, SCREEN_HEIGHT, 100, snapshot);
+ *   before sleeping:  roboEyes.saveState(snapshot); esp_deep_sleep_start();
+ *
+ * The first frame after begin() shows the saved frame as it was, also in the middle of an
+ * animation, which continues from there with the next frame.
+ * Timers are saved as the time left, so a blink due in 2 seconds is due 2 seconds after
+ * begin(). A sequence started with playSequence() is not saved, as it's an address in flash.
+ * If the snapshot is invalid (e.g. empty EEPROM) or was saved for another screen size,
+ * begin() returns false and starts with closed eyes as usual.
+ *
+ * Snapshot format, all values little-endian, the same for any ROBOEYES_FEATURES (values of
+ * features not compiled in are saved as 0 and ignored when restoring):
+ *   header:  'R' 'S' version(1) size(1)
+ *   flags:   32 bit, ROBOEYES_SNAPSHOT_ bits below
+ *   screen:  screenWidth screenHeight viewportX viewportY (16 bit each)
+ *   shapes:  current values, then targets of the 14 animated parameters (16 bit each, in the
+ *            order of ROBOEYES_PARAM_ with all moods), shapes the eyes return to, height offsets
+ *   anims:   flicker amplitudes, blink and idle intervals, confused and laugh durations,
+ *            time left until the next blink and idle movement (32 bit), until the end of
+ *            confused and laugh (16 bit), tween half-lives, easings, random generator state
+ *   gaze:    gaze target, position, velocity and limits (16 bit each)
+ *   check:   Fletcher-16 checksum of all bytes before
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_SNAPSHOT_H
+#define _FLUXGARAGE_ROBOEYES_SNAPSHOT_H
+
+#include <stdint.h>
+
+#define ROBOEYES_SNAPSHOT_VERSION 1
+#define ROBOEYES_SNAPSHOT_SIZE 146 // bytes, including header and checksum
+
+// Bits of the flags
+#define ROBOEYES_SNAPSHOT_LEFT_OPEN 0x00001
+#define ROBOEYES_SNAPSHOT_RIGHT_OPEN 0x00002
+#define ROBOEYES_SNAPSHOT_TIRED 0x00004
+#define ROBOEYES_SNAPSHOT_ANGRY 0x00008
+#define ROBOEYES_SNAPSHOT_HAPPY 0x00010
+#define ROBOEYES_SNAPSHOT_CURIOUS 0x00020
+#define ROBOEYES_SNAPSHOT_CYCLOPS 0x00040
+#define ROBOEYES_SNAPSHOT_HFLICKER 0x00080
+#define ROBOEYES_SNAPSHOT_HFLICKER_ALTERNATE 0x00100
+#define ROBOEYES_SNAPSHOT_VFLICKER 0x00200
+#define ROBOEYES_SNAPSHOT_VFLICKER_ALTERNATE 0x00400
+#define ROBOEYES_SNAPSHOT_AUTOBLINKER 0x00800
+#define ROBOEYES_SNAPSHOT_IDLE 0x01000
+#define ROBOEYES_SNAPSHOT_CONFUSED 0x02000
+#define ROBOEYES_SNAPSHOT_CONFUSED_TOGGLE 0x04000
+#define ROBOEYES_SNAPSHOT_LAUGH 0x08000
+#define ROBOEYES_SNAPSHOT_LAUGH_TOGGLE 0x10000
+#define ROBOEYES_SNAPSHOT_GAZE 0x20000
+#define ROBOEYES_SNAPSHOT_ADAPTIVE 0x40000 // adaptive frame rate
+#define ROBOEYES_SNAPSHOT_VIEWPORT 0x80000 // setViewport() limits the eyes to a part of the display
+#define ROBOEYES_SNAPSHOT_SETTLED 0x100000 // the eyes were at rest, update() had nothing to draw
+
+// Writes and reads the values of a snapshot byte by byte, so the format doesn't depend on the
+// memory layout of the board, and keeps the checksum
+class RoboEyes_SnapshotStream
+{
+public:
+
+uint8_t *out; // snapshot being written, 0 when reading
+const uint8_t *in; // snapshot being read
+uint16_t position = 0; // bytes written or read so far
+uint8_t sum1 = 0; // Fletcher-16 sums of these bytes
+uint8_t sum2 = 0;
+
+RoboEyes_SnapshotStream(uint8_t *data) : out(data), in(data) {}
+RoboEyes_SnapshotStream(const uint8_t *data) : out(0), in(data) {}
+
+void put8(uint8_t value) {
+  out[position++] = value;
+  add(value);
+}
+void put16(uint16_t value) {
+  put8(value);
+  put8(value >> 8);
+}
+void put32(uint32_t value) {
+  put16(value);
+  put16(value >> 16);
+}
+
+uint8_t get8() {
+  uint8_t value = in[position++];
+  add(value);
+  return value;
+}
+int16_t get16() {
+  uint16_t value = get8();
+  return value | ((uint16_t)get8() << 8);
+}
+uint32_t get32() {
+  uint32_t value = (uint16_t)get16();
+  return value | ((uint32_t)(uint16_t)get16() << 16);
+}
+
+// Checksum of the bytes so far, written after them
+uint16_t checksum() const {
+  return ((uint16_t)sum2 << 8) | sum1;
+}
+
+private:
+
+void add(uint8_t value) {
+  sum1 = (sum1 + value) % 255;
+  sum2 = (sum2 + sum1) % 255;
+}
+
+}; // end of class RoboEyes_SnapshotStream
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * RoboEyes on colour TFT displays (RGB565) without a frame buffer, e.g. 240x240 ST7789
+ * displays, where a full frame buffer (115 KB) doesn't fit into the RAM of most boards.
+ * RoboEyes_TFT draws the changed screen region band by band: ROWS pixel rows at a time
+ * into a small strip buffer, each band sent to its window on the display. Only the region
+ * covering the eyes of the last and the current frame is drawn and sent.
+ *
+ *   Adafruit_ST7789 tft(TFT_CS, TFT_DC, TFT_RST);
+ *   RoboEyes_TFT<Adafruit_ST7789, 240, 240> display(tft); // 240 columns x 8 rows strip = 3840 bytes
+ *   RoboEyes<RoboEyes_TFT<Adafruit_ST7789, 240, 240> > eyes(display);
+ *
+ *   setup(): tft.init(240, 240);
+ *            display.setColors(0x07FF, 0x0000); // cyan eyes on black
+ *            eyes.begin(240, 240, 50);
+ *   loop():  eyes.update();
+ *
+ * The panel class needs the Adafruit_SPITFT methods startWrite(), setAddrWindow(),
+ * writePixels(), endWrite() and fillScreen(). With setNativeRaster(OFF), the eyes are
+ * drawn with the panel's own drawing methods instead (flickers, no strip buffer used).
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_TFT_H
+#define _FLUXGARAGE_ROBOEYES_TFT_H
+
+#include "FluxGarage_RoboEyes_Raster.h"
+
+// Default number of pixel rows per band, max. 32
+#ifndef ROBOEYES_STRIP_ROWS
+#define ROBOEYES_STRIP_ROWS 8
+#endif
+
+template <class Panel, int WIDTH, int HEIGHT, int ROWS = ROBOEYES_STRIP_ROWS>
+class RoboEyes_TFT : public RoboEyes_LayerDisplay
+{
+public:
+
+static_assert(ROWS >= 1 && ROWS <= 32, "RoboEyes_TFT: ROWS must be 1...32");
+
+Panel &panel;
+uint16_t eyeColor = 0xFFFF; // RGB565, white
+uint16_t backgroundColor = 0x0000; // RGB565, black
+uint16_t strip[WIDTH*ROWS]; // one band of the changed region, rows of (x1-x0+1) pixels
+unsigned long bytesSent = 0; // bytes sent to the display so far
+unsigned long bandsSent = 0; // bands sent to the display so far
+
+RoboEyes_TFT(Panel &p) : panel(p) {}
+
+int16_t width() const { return WIDTH; }
+int16_t height() const { return HEIGHT; }
+
+// Set the colours of eyes and background in RGB565, call forceFullRedraw() of the eyes afterwards
+void setColors(uint16_t eye, uint16_t background) {
+  eyeColor = eye;
+  backgroundColor = background;
+}
+
+// There is no display buffer: clearing fills the screen, sending happens while drawing
+void clearDisplay() {
+  panel.fillScreen(backgroundColor);
+}
+void display() {}
+
+// Drawing methods for setNativeRaster(OFF), drawn straight onto the panel, color 0 = background
+void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  panel.fillRect(x, y, w, h, color ? eyeColor : backgroundColor);
+}
+void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  panel.fillRoundRect(x, y, w, h, r, color ? eyeColor : backgroundColor);
+}
+void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  panel.fillTriangle(x0, y0, x1, y1, x2, y2, color ? eyeColor : backgroundColor);
+}
+
+// Draw rows y0...y1 of columns x0...x1 band by band, see RoboEyes_LayerDisplay
+unsigned long drawLayers(const RoboEyes_Layer *layers, uint8_t count, int16_t x0, int16_t x1, int16_t y0, int16_t y1) {
+  if(x0 < 0){x0 = 0;}
+  if(x1 > WIDTH-1){x1 = WIDTH-1;}
+  if(y0 < 0){y0 = 0;}
+  if(y1 > HEIGHT-1){y1 = HEIGHT-1;}
+  if(x1 < x0 || y1 < y0){return 0;}
+  int16_t w = x1-x0+1;
+  unsigned long bytes = 0;
+  panel.startWrite();
+  for(int16_t band = y0; band <= y1; band += ROWS){
+    int16_t rows = (y1-band+1 < ROWS) ? y1-band+1 : ROWS;
+    drawBand(layers, count, x0, x1, band, rows);
+    panel.setAddrWindow(x0, band, w, rows);
+    panel.writePixels(strip, (uint32_t)w*rows);
+    bytes += (unsigned long)w*rows*2;
+    bandsSent++;
+  }
+  panel.endWrite();
+  bytesSent += bytes;
+  return bytes;
+}
+
+// Draw rows band...band+rows-1 of columns x0...x1 into the strip buffer
+void drawBand(const RoboEyes_Layer *layers, uint8_t count, int16_t x0, int16_t x1, int16_t band, int16_t rows) {
+  int16_t w = x1-x0+1;
+  for(int16_t i = 0; i < w*rows; i++){
+    strip[i] = backgroundColor;
+  }
+  for(int16_t x = x0; x <= x1; x++){
+    // Rows of this band covered by eye layers and not by cutting layers, one bit per row
+    uint32_t eye = 0;
+    uint32_t cut = 0;
+    for(uint8_t l = 0; l < count; l++){
+      int16_t top, bottom;
+      if(!RoboEyes_Raster::columnSpan(layers[l], x, top, bottom)){continue;}
+      if(layers[l].type == ROBOEYES_LAYER_EYE){
+        eye |= rowMask(top, bottom, band, rows);
+      } else {
+        cut |= rowMask(top, bottom, band, rows);
+      }
+    }
+    uint32_t visible = eye & ~cut;
+    uint16_t *ptr = strip + (x-x0);
+    while(visible){
+      if(visible & 1){*ptr = eyeColor;}
+      visible >>= 1;
+      ptr += w;
+    }
+  }
+}
+
+// Bits of the rows band...band+rows-1 covered by rows top...bottom, bit 0 = row band
+static uint32_t rowMask(int16_t top, int16_t bottom, int16_t band, int16_t rows) {
+  if(top < band){top = band;}
+  if(bottom > band+rows-1){bottom = band+rows-1;}
+  if(bottom < top){return 0;}
+  uint32_t span = (bottom-top == 31) ? 0xFFFFFFFF : ((uint32_t)1 << (bottom-top+1))-1;
+  return span << (top-band);
+}
+
+}; // end of class RoboEyes_TFT
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Interface for sending frames to a display without blocking, e.g. by DMA, by an
+ * interrupt routine or in small steps from the main loop. With RoboEyes::setAsyncFlush(),
+ * RoboEyes copies each changed screen region into a second (front) buffer and hands it to
+ * the transport, while the next frame is already drawn into the display's own buffer.
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _FLUXGARAGE_ROBOEYES_TRANSPORT_H
+#define _FLUXGARAGE_ROBOEYES_TRANSPORT_H
+
+#include <stdint.h>
+
+class RoboEyes_Transport
+{
+public:
+
+virtual ~RoboEyes_Transport() {}
+
+// Start sending columns x0...x1 of pages page0...page1 (one page = 8 pixel rows) from buffer,
+// which holds width bytes per page. Must return right away, buffer stays unchanged until busy() returns false.
+virtual void send(const uint8_t *buffer, int16_t width, int16_t x0, int16_t x1, uint8_t page0, uint8_t page1) = 0;
+
+// Returns true while a transfer is running
+virtual bool busy() = 0;
+
+// Called by RoboEyes::update(), for transports that move the data in small steps instead of by DMA or interrupts
+virtual void poll() {}
+
+}; // end of class RoboEyes_Transport
+
+#endif
@@ -0,0 +1,97 @@
+//***********************************************************************************************
+//  This example draws the eyes in a task of their own on the second core of an ESP32, while
+//  other tasks change the eyes: a "sensor" task sends gaze readings 1000 times per second and
+//  a "network" task sends moods and animations. They don't call the methods of roboEyes
+//  directly, which could change the eyes while a frame is being drawn, but put commands into a
+//  command queue. The render task runs the commands between two frames.
+//
+//  Hardware: You'll need an ESP32 board, an I2C oled display with 1306 or 1309 chip and some
+//  jumper wires. Optionally a joystick module on pins 34 and 35 for the gaze.
+//  
+//  Published in September 2024 by Dennis Hoelscher, FluxGarage
+//  www.youtube.com/@FluxGarage
+//  www.fluxgarage.com
+//
+//***********************************************************************************************
+
+
+#include <Adafruit_SSD1306.h>
+#include <FluxGarage_RoboEyes_SSD1306.h> // adds partial screen updates to Adafruit_SSD1306
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+// Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
+#define OLED_RESET     -1 // Reset pin # (or -1 if sharing Arduino reset pin)
+RoboEyes_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET); // only sends changed parts of the screen
+
+#include <FluxGarage_RoboEyes.h>
+#include <FluxGarage_RoboEyes_Commands.h>
+roboEyes roboEyes; // create eyes, only used by the render task
+RoboEyes_CommandQueue<32> commands; // commands from all other tasks
+
+// Joystick pins
+int joystickXpin = 34;
+int joystickYpin = 35;
+
+
+// Render task: runs the commands of the other tasks and draws the eyes
+void renderTask(void *parameter) {
+  for(;;){
+    roboEyes.runCommands(commands);
+    roboEyes.update();
+    // Wait until the next frame, blink or idle movement is due, but at most 10ms to stay quick for new commands
+    unsigned long wait = roboEyes.msUntilNextWork();
+    if(wait > 10){wait = 10;}
+    vTaskDelay(wait ? pdMS_TO_TICKS(wait) : 1); // at least one tick, to give the idle task of this core some time
+  }
+}
+
+// Sensor task: gaze readings from the joystick, 1000 times per second
+void sensorTask(void *parameter) {
+  for(;;){
+    int16_t x = map(analogRead(joystickXpin), 0, 4095, -32768, 32767);
+    int16_t y = map(analogRead(joystickYpin), 0, 4095, -32768, 32767);
+    commands.setGaze(x, y); // readings between two frames are merged, the eyes are only redrawn if they move
+    vTaskDelay(pdMS_TO_TICKS(1));
+  }
+}
+
+// Network task: here just a mood change and an animation every few seconds
+void networkTask(void *parameter) {
+  byte mood = 0;
+  for(;;){
+    vTaskDelay(pdMS_TO_TICKS(3000));
+    mood = (mood+1) % 4; // DEFAULT, TIRED, ANGRY, HAPPY
+    commands.setMood(mood);
+    if(mood == HAPPY){commands.anim_laugh();}
+    else {commands.blink();}
+  }
+}
+
+
+void setup() {
+  Serial.begin(115200);
+
+  // Startup OLED Display
+  // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
+  if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) { // Address 0x3C or 0x3D
+    Serial.println(F("SSD1306 allocation failed"));
+    for(;;); // Don't proceed, loop forever
+  }
+
+  // Startup robo eyes, before the render task starts
+  roboEyes.begin(SCREEN_WIDTH, SCREEN_HEIGHT, 100); // screen-width, screen-height, max framerate
+  roboEyes.setGazeLimits(300, 3000); // follow the gaze with max. 300 pixels per second, accelerating with max. 3000 pixels per second per second
+  roboEyes.setAutoblinker(ON, 3, 2);
+
+  // From now on, only the render task uses roboEyes
+  xTaskCreatePinnedToCore(renderTask, "eyes", 4096, NULL, 2, NULL, 1); // core 1
+  xTaskCreatePinnedToCore(sensorTask, "sensor", 2048, NULL, 1, NULL, 0); // core 0
+  xTaskCreatePinnedToCore(networkTask, "network", 2048, NULL, 1, NULL, 0);
+
+} // end of setup
+
+
+void loop() {
+  vTaskDelay(pdMS_TO_TICKS(1000)); // nothing to do here, everything runs in the tasks above
+}
@@ -12,12 +12,13 @@
 
 
 #include <Adafruit_SSD1306.h>
+#include <FluxGarage_RoboEyes_SSD1306.h> // adds partial screen updates to Adafruit_SSD1306
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 // Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
 #define OLED_RESET     -1 // Reset pin # (or -1 if sharing Arduino reset pin)
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+RoboEyes_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET); // only sends changed parts of the screen
 
 #include <FluxGarage_RoboEyes.h>
 roboEyes roboEyes; // create eyes
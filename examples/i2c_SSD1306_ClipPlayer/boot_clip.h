@@ -0,0 +1,247 @@
+// Clip for RoboEyes_ClipPlayer, generated by extras/host/RoboEyes_ClipEncoder.cpp
+// 251 frames of 128x64 pixels, 20 ms per frame (5.02 s), 3877 bytes
+const uint8_t bootClip[] PROGMEM = {
+  0x52,0x43,0x01,0x80,0x08,0x14,0xfb,0x00,0x03,0x17,0x23,0xa3,0x04,0x03,0x45,0x23,
+  0xa3,0x04,0xff,0x03,0x17,0x23,0xa3,0x20,0x03,0x45,0x23,0xa3,0x20,0xff,0x03,0x17,
+  0x23,0xa3,0x40,0x03,0x45,0x23,0xa3,0x40,0xff,0x03,0x17,0x23,0xa3,0x80,0x03,0x45,
+  0x23,0xa3,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x1b,0x1b,0x01,0x80,0x80,
+  0x97,0xc0,0x01,0x80,0x80,0x02,0x49,0x1b,0x01,0x80,0x80,0x97,0xc0,0x01,0x80,0x80,
+  0x03,0x17,0x23,0x02,0xf0,0xfc,0xfe,0x9d,0xff,0x02,0xfe,0xfc,0xf0,0x03,0x45,0x23,
+  0x02,0xf0,0xfc,0xfe,0x9d,0xff,0x02,0xfe,0xfc,0xf0,0x04,0x17,0x23,0xa3,0xff,0x04,
+  0x45,0x23,0xa3,0xff,0x05,0x17,0x23,0x03,0x07,0x1f,0x3f,0x7f,0x9b,0xff,0x03,0x7f,
+  0x3f,0x1f,0x07,0x05,0x45,0x23,0x03,0x07,0x1f,0x3f,0x7f,0x9b,0xff,0x03,0x7f,0x3f,
+  0x1f,0x07,0x06,0x1d,0x17,0x97,0x01,0x06,0x4b,0x17,0x97,0x01,0xff,0x02,0x17,0x23,
+  0x05,0x80,0xe0,0xf0,0xf8,0xfc,0xfc,0x97,0xfe,0x05,0xfc,0xfc,0xf8,0xf0,0xe0,0x80,
+  0x02,0x45,0x23,0x05,0x80,0xe0,0xf0,0xf8,0xfc,0xfc,0x97,0xfe,0x05,0xfc,0xfc,0xf8,
+  0xf0,0xe0,0x80,0x03,0x17,0x02,0x82,0xff,0x03,0x38,0x02,0x82,0xff,0x03,0x45,0x02,
+  0x82,0xff,0x03,0x66,0x02,0x82,0xff,0x05,0x17,0x03,0x03,0x0f,0x3f,0x7f,0xff,0x05,
+  0x37,0x03,0x03,0xff,0x7f,0x3f,0x0f,0x05,0x45,0x03,0x03,0x0f,0x3f,0x7f,0xff,0x05,
+  0x65,0x03,0x03,0xff,0x7f,0x3f,0x0f,0x06,0x1b,0x1b,0x01,0x01,0x01,0x97,0x03,0x01,
+  0x01,0x01,0x06,0x49,0x1b,0x01,0x01,0x01,0x97,0x03,0x01,0x01,0x01,0xff,0x01,0x1d,
+  0x17,0x97,0x80,0x01,0x4b,0x17,0x97,0x80,0x02,0x17,0x23,0x03,0xe0,0xf8,0xfc,0xfe,
+  0x9b,0xff,0x03,0xfe,0xfc,0xf8,0xe0,0x02,0x45,0x23,0x03,0xe0,0xf8,0xfc,0xfe,0x9b,
+  0xff,0x03,0xfe,0xfc,0xf8,0xe0,0xff,0x01,0x1b,0x1b,0x01,0x80,0x80,0x97,0xc0,0x01,
+  0x80,0x80,0x01,0x49,0x1b,0x01,0x80,0x80,0x97,0xc0,0x01,0x80,0x80,0x02,0x17,0x03,
+  0x03,0xf0,0xfc,0xfe,0xff,0x02,0x37,0x03,0x03,0xff,0xfe,0xfc,0xf0,0x02,0x45,0x03,
+  0x03,0xf0,0xfc,0xfe,0xff,0x02,0x65,0x03,0x03,0xff,0xfe,0xfc,0xf0,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x01,0x17,0x23,0x05,0x80,0xe0,0xf0,0xf8,0xfc,0xfc,0x97,0xfe,
+  0x05,0xfc,0xfc,0xf8,0xf0,0xe0,0x80,0x01,0x45,0x23,0x05,0x80,0xe0,0xf0,0xf8,0xfc,
+  0xfc,0x97,0xfe,0x05,0xfc,0xfc,0xf8,0xf0,0xe0,0x80,0x02,0x17,0x02,0x82,0xff,0x02,
+  0x38,0x02,0x82,0xff,0x02,0x45,0x02,0x82,0xff,0x02,0x66,0x02,0x82,0xff,0x04,0x17,
+  0x23,0x04,0x1f,0x0f,0x07,0x03,0x03,0x99,0x01,0x04,0x03,0x03,0x07,0x0f,0x1f,0x04,
+  0x45,0x23,0x04,0x1f,0x0f,0x07,0x03,0x03,0x99,0x01,0x04,0x03,0x03,0x07,0x0f,0x1f,
+  0x05,0x17,0x23,0xa3,0x00,0x05,0x45,0x23,0xa3,0x00,0x06,0x1b,0x1b,0x9b,0x00,0x06,
+  0x49,0x1b,0x9b,0x00,0xff,0x01,0x17,0x23,0xa3,0x00,0x01,0x45,0x23,0xa3,0x00,0x02,
+  0x17,0x23,0x05,0x80,0xe0,0xf0,0xf8,0xfc,0xfc,0x97,0xfe,0x05,0xfc,0xfc,0xf8,0xf0,
+  0xe0,0x80,0x02,0x45,0x23,0x05,0x80,0xe0,0xf0,0xf8,0xfc,0xfc,0x97,0xfe,0x05,0xfc,
+  0xfc,0xf8,0xf0,0xe0,0x80,0x04,0x17,0x23,0x82,0xff,0x01,0x7f,0x7f,0x99,0x3f,0x01,
+  0x7f,0x7f,0x82,0xff,0x04,0x45,0x23,0x82,0xff,0x01,0x7f,0x7f,0x99,0x3f,0x01,0x7f,
+  0x7f,0x82,0xff,0x05,0x17,0x01,0x01,0x03,0x01,0x05,0x39,0x01,0x01,0x01,0x03,0x05,
+  0x45,0x01,0x01,0x03,0x01,0x05,0x67,0x01,0x01,0x01,0x03,0xff,0x01,0x18,0x21,0x04,
+  0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x01,0x46,0x21,
+  0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x02,0x17,
+  0x23,0xa3,0xff,0x02,0x45,0x23,0xa3,0xff,0x03,0x1a,0x1d,0x01,0x7f,0x7f,0x99,0x3f,
+  0x01,0x7f,0x7f,0x03,0x48,0x1d,0x01,0x7f,0x7f,0x99,0x3f,0x01,0x7f,0x7f,0x04,0x17,
+  0x23,0x01,0x03,0x01,0x9f,0x00,0x01,0x01,0x03,0x04,0x45,0x23,0x01,0x03,0x01,0x9f,
+  0x00,0x01,0x01,0x03,0x05,0x17,0x01,0x01,0x00,0x00,0x05,0x39,0x01,0x01,0x00,0x00,
+  0x05,0x45,0x01,0x01,0x00,0x00,0x05,0x67,0x01,0x01,0x00,0x00,0xff,0x01,0x18,0x21,
+  0xa1,0x00,0x01,0x46,0x21,0xa1,0x00,0x02,0x17,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,
+  0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x02,0x45,0x23,0x05,0x00,0xc0,
+  0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x03,0x1a,0x1d,
+  0x9d,0xff,0x03,0x48,0x1d,0x9d,0xff,0x04,0x17,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,
+  0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x04,0x45,0x23,0x04,0xff,0xff,0x7f,0x3f,
+  0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x05,0x17,0x00,0x00,0x01,0x05,0x3a,
+  0x00,0x00,0x01,0x05,0x45,0x00,0x00,0x01,0x05,0x68,0x00,0x00,0x01,0xff,0x01,0x18,
+  0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x01,
+  0x46,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,
+  0x02,0x17,0x23,0xa3,0xff,0x02,0x45,0x23,0xa3,0xff,0x03,0x19,0x1f,0x02,0x7f,0x3f,
+  0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x03,0x47,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,
+  0x02,0x3f,0x3f,0x7f,0x04,0x17,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x04,0x45,0x23,
+  0x00,0x01,0xa1,0x00,0x00,0x01,0x05,0x17,0x00,0x00,0x00,0x05,0x3a,0x00,0x00,0x00,
+  0x05,0x45,0x00,0x00,0x00,0x05,0x68,0x00,0x00,0x00,0xff,0x01,0x18,0x21,0xa1,0x00,
+  0x01,0x46,0x21,0xa1,0x00,0x02,0x17,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,
+  0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x02,0x45,0x23,0x05,0x00,0xc0,0xe0,0xf0,
+  0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x03,0x19,0x1f,0x9f,0xff,
+  0x03,0x47,0x1f,0x9f,0xff,0x04,0x17,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,
+  0x04,0x3f,0x3f,0x7f,0xff,0xff,0x04,0x45,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,
+  0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x05,0x17,0x00,0x00,0x01,0x05,0x3a,0x00,0x00,
+  0x01,0x05,0x45,0x00,0x00,0x01,0x05,0x68,0x00,0x00,0x01,0xff,0x01,0x18,0x21,0x04,
+  0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x01,0x46,0x21,
+  0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x02,0x17,
+  0x23,0xa3,0xff,0x02,0x45,0x23,0xa3,0xff,0x03,0x19,0x1f,0x02,0x7f,0x3f,0x3f,0x99,
+  0x1f,0x02,0x3f,0x3f,0x7f,0x03,0x47,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,
+  0x3f,0x7f,0x04,0x17,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x04,0x45,0x23,0x00,0x01,
+  0xa1,0x00,0x00,0x01,0x05,0x17,0x00,0x00,0x00,0x05,0x3a,0x00,0x00,0x00,0x05,0x45,
+  0x00,0x00,0x00,0x05,0x68,0x00,0x00,0x00,0xff,0x01,0x18,0x21,0xa1,0x00,0x01,0x46,
+  0x21,0xa1,0x00,0x02,0x17,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,
+  0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x02,0x45,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,
+  0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x03,0x19,0x1f,0x9f,0xff,0x03,0x47,
+  0x1f,0x9f,0xff,0x04,0x17,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,
+  0x3f,0x7f,0xff,0xff,0x04,0x45,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,
+  0x3f,0x3f,0x7f,0xff,0xff,0x05,0x17,0x00,0x00,0x01,0x05,0x3a,0x00,0x00,0x01,0x05,
+  0x45,0x00,0x00,0x01,0x05,0x68,0x00,0x00,0x01,0xff,0x01,0x18,0x21,0x04,0xc0,0xe0,
+  0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x01,0x46,0x21,0x04,0xc0,
+  0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x02,0x17,0x23,0xa3,
+  0xff,0x02,0x45,0x23,0xa3,0xff,0x03,0x19,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,
+  0x3f,0x3f,0x7f,0x03,0x47,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,
+  0x04,0x17,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x04,0x45,0x23,0x00,0x01,0xa1,0x00,
+  0x00,0x01,0x05,0x17,0x00,0x00,0x00,0x05,0x3a,0x00,0x00,0x00,0x05,0x45,0x00,0x00,
+  0x00,0x05,0x68,0x00,0x00,0x00,0xff,0x01,0x18,0x21,0xa1,0x00,0x01,0x46,0x21,0xa1,
+  0x00,0x02,0x17,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,
+  0xf0,0xe0,0xc0,0x00,0x02,0x45,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,
+  0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x03,0x19,0x1f,0x9f,0xff,0x03,0x47,0x1f,0x9f,
+  0xff,0x04,0x17,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,
+  0xff,0xff,0x04,0x45,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,
+  0x7f,0xff,0xff,0x05,0x17,0x00,0x00,0x01,0x05,0x3a,0x00,0x00,0x01,0x05,0x45,0x00,
+  0x00,0x01,0x05,0x68,0x00,0x00,0x01,0xff,0x01,0x18,0x21,0x04,0xc0,0xe0,0xf0,0xf8,
+  0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x01,0x46,0x21,0x04,0xc0,0xe0,0xf0,
+  0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x02,0x17,0x23,0xa3,0xff,0x02,
+  0x45,0x23,0xa3,0xff,0x03,0x19,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,
+  0x7f,0x03,0x47,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x04,0x17,
+  0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x04,0x45,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,
+  0x05,0x17,0x00,0x00,0x00,0x05,0x3a,0x00,0x00,0x00,0x05,0x45,0x00,0x00,0x00,0x05,
+  0x68,0x00,0x00,0x00,0xff,0x01,0x18,0x21,0xa1,0x00,0x01,0x46,0x21,0xa1,0x00,0x02,
+  0x17,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,
+  0xc0,0x00,0x02,0x45,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,
+  0xf8,0xf0,0xe0,0xc0,0x00,0x03,0x19,0x1f,0x9f,0xff,0x03,0x47,0x1f,0x9f,0xff,0x04,
+  0x17,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,
+  0x04,0x45,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,
+  0xff,0x05,0x17,0x00,0x00,0x01,0x05,0x3a,0x00,0x00,0x01,0x05,0x45,0x00,0x00,0x01,
+  0x05,0x68,0x00,0x00,0x01,0xff,0x01,0x18,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,
+  0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x01,0x46,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,
+  0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x02,0x17,0x23,0xa3,0xff,0x02,0x45,0x23,
+  0xa3,0xff,0x03,0x19,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x03,
+  0x47,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x04,0x17,0x23,0x00,
+  0x01,0xa1,0x00,0x00,0x01,0x04,0x45,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x05,0x17,
+  0x00,0x00,0x00,0x05,0x3a,0x00,0x00,0x00,0x05,0x45,0x00,0x00,0x00,0x05,0x68,0x00,
+  0x00,0x00,0xff,0x01,0x18,0x21,0xa1,0x00,0x01,0x46,0x21,0xa1,0x00,0x02,0x17,0x23,
+  0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,
+  0x02,0x45,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,
+  0xe0,0xc0,0x00,0x03,0x19,0x1f,0x9f,0xff,0x03,0x47,0x1f,0x9f,0xff,0x04,0x17,0x23,
+  0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x04,0x45,
+  0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x05,
+  0x17,0x00,0x00,0x01,0x05,0x3a,0x00,0x00,0x01,0x05,0x45,0x00,0x00,0x01,0x05,0x68,
+  0x00,0x00,0x01,0xff,0x01,0x18,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,
+  0xf8,0xf8,0xf0,0xe0,0xc0,0x01,0x46,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,
+  0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x02,0x17,0x23,0xa3,0xff,0x02,0x45,0x23,0xa3,0xff,
+  0x03,0x19,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x03,0x47,0x1f,
+  0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x04,0x17,0x23,0x00,0x01,0xa1,
+  0x00,0x00,0x01,0x04,0x45,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x05,0x17,0x00,0x00,
+  0x00,0x05,0x3a,0x00,0x00,0x00,0x05,0x45,0x00,0x00,0x00,0x05,0x68,0x00,0x00,0x00,
+  0xff,0x01,0x18,0x21,0xa1,0x00,0x01,0x46,0x21,0xa1,0x00,0x02,0x17,0x23,0x05,0x00,
+  0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x02,0x45,
+  0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,
+  0x00,0x03,0x19,0x1f,0x9f,0xff,0x03,0x47,0x1f,0x9f,0xff,0x04,0x17,0x23,0x04,0xff,
+  0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x04,0x45,0x23,0x04,
+  0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x05,0x17,0x00,
+  0x00,0x01,0x05,0x3a,0x00,0x00,0x01,0x05,0x45,0x00,0x00,0x01,0x05,0x68,0x00,0x00,
+  0x01,0xff,0x01,0x18,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,
+  0xf0,0xe0,0xc0,0x01,0x46,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,
+  0xf8,0xf0,0xe0,0xc0,0x02,0x17,0x23,0xa3,0xff,0x02,0x45,0x23,0xa3,0xff,0x03,0x19,
+  0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x03,0x47,0x1f,0x02,0x7f,
+  0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x04,0x17,0x23,0x00,0x01,0xa1,0x00,0x00,
+  0x01,0x04,0x45,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x05,0x17,0x00,0x00,0x00,0x05,
+  0x3a,0x00,0x00,0x00,0x05,0x45,0x00,0x00,0x00,0x05,0x68,0x00,0x00,0x00,0xff,0x01,
+  0x18,0x21,0xa1,0x00,0x01,0x46,0x21,0xa1,0x00,0x02,0x17,0x23,0x05,0x00,0xc0,0xe0,
+  0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x02,0x45,0x23,0x05,
+  0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x03,
+  0x19,0x1f,0x9f,0xff,0x03,0x47,0x1f,0x9f,0xff,0x04,0x17,0x23,0x04,0xff,0xff,0x7f,
+  0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x04,0x45,0x23,0x04,0xff,0xff,
+  0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x05,0x17,0x00,0x00,0x01,
+  0x05,0x3a,0x00,0x00,0x01,0x05,0x45,0x00,0x00,0x01,0x05,0x68,0x00,0x00,0x01,0xff,
+  0x01,0x18,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,
+  0xc0,0x01,0x46,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,
+  0xe0,0xc0,0x02,0x17,0x23,0xa3,0xff,0x02,0x45,0x23,0xa3,0xff,0x03,0x19,0x1f,0x02,
+  0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x03,0x47,0x1f,0x02,0x7f,0x3f,0x3f,
+  0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x04,0x17,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x04,
+  0x45,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x05,0x17,0x00,0x00,0x00,0x05,0x3a,0x00,
+  0x00,0x00,0x05,0x45,0x00,0x00,0x00,0x05,0x68,0x00,0x00,0x00,0xff,0x01,0x18,0x21,
+  0xa1,0x00,0x01,0x46,0x21,0xa1,0x00,0x02,0x17,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,
+  0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x02,0x45,0x23,0x05,0x00,0xc0,
+  0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x03,0x19,0x1f,
+  0x9f,0xff,0x03,0x47,0x1f,0x9f,0xff,0x04,0x17,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,
+  0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x04,0x45,0x23,0x04,0xff,0xff,0x7f,0x3f,
+  0x3f,0x99,0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x05,0x17,0x00,0x00,0x01,0x05,0x3a,
+  0x00,0x00,0x01,0x05,0x45,0x00,0x00,0x01,0x05,0x68,0x00,0x00,0x01,0xff,0x01,0x18,
+  0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x01,
+  0x46,0x21,0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,
+  0x02,0x17,0x23,0xa3,0xff,0x02,0x45,0x23,0xa3,0xff,0x03,0x19,0x1f,0x02,0x7f,0x3f,
+  0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,0x03,0x47,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,
+  0x02,0x3f,0x3f,0x7f,0x04,0x17,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x04,0x45,0x23,
+  0x00,0x01,0xa1,0x00,0x00,0x01,0x05,0x17,0x00,0x00,0x00,0x05,0x3a,0x00,0x00,0x00,
+  0x05,0x45,0x00,0x00,0x00,0x05,0x68,0x00,0x00,0x00,0xff,0x01,0x18,0x21,0xa1,0x00,
+  0x01,0x46,0x21,0xa1,0x00,0x02,0x17,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,
+  0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x02,0x45,0x23,0x05,0x00,0xc0,0xe0,0xf0,
+  0xf8,0xf8,0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x03,0x19,0x1f,0x9f,0xff,
+  0x03,0x47,0x1f,0x9f,0xff,0x04,0x17,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,
+  0x04,0x3f,0x3f,0x7f,0xff,0xff,0x04,0x45,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,
+  0x1f,0x04,0x3f,0x3f,0x7f,0xff,0xff,0x05,0x17,0x00,0x00,0x01,0x05,0x3a,0x00,0x00,
+  0x01,0x05,0x45,0x00,0x00,0x01,0x05,0x68,0x00,0x00,0x01,0xff,0x01,0x18,0x21,0x04,
+  0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x01,0x46,0x21,
+  0x04,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x02,0x17,
+  0x23,0xa3,0xff,0x02,0x45,0x23,0xa3,0xff,0x03,0x19,0x1f,0x02,0x7f,0x3f,0x3f,0x99,
+  0x1f,0x02,0x3f,0x3f,0x7f,0x03,0x47,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,
+  0x3f,0x7f,0x04,0x17,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x04,0x45,0x23,0x00,0x01,
+  0xa1,0x00,0x00,0x01,0x05,0x17,0x00,0x00,0x00,0x05,0x3a,0x00,0x00,0x00,0x05,0x45,
+  0x00,0x00,0x00,0x05,0x68,0x00,0x00,0x00,0xff,0x01,0x18,0x21,0xa1,0x00,0x01,0x46,
+  0x21,0xa1,0x00,0x02,0x17,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x05,
+  0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x02,0x45,0x23,0x05,0x00,0xc0,0xe0,0xf0,0xf8,0xf8,
+  0x97,0xfc,0x05,0xf8,0xf8,0xf0,0xe0,0xc0,0x00,0x03,0x19,0x1f,0x9f,0xff,0x03,0x47,
+  0x1f,0x9f,0xff,0x04,0x17,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,0x3f,
+  0x3f,0x7f,0xff,0xff,0x04,0x45,0x23,0x04,0xff,0xff,0x7f,0x3f,0x3f,0x99,0x1f,0x04,
+  0x3f,0x3f,0x7f,0xff,0xff,0x05,0x17,0x00,0x00,0x01,0x05,0x3a,0x00,0x00,0x01,0x05,
+  0x45,0x00,0x00,0x01,0x05,0x68,0x00,0x00,0x01,0xff,0x01,0x18,0x21,0x04,0xc0,0xe0,
+  0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x01,0x46,0x21,0x04,0xc0,
+  0xe0,0xf0,0xf8,0xf8,0x97,0xfc,0x04,0xf8,0xf8,0xf0,0xe0,0xc0,0x02,0x17,0x23,0xa3,
+  0xff,0x02,0x45,0x23,0xa3,0xff,0x03,0x19,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,
+  0x3f,0x3f,0x7f,0x03,0x47,0x1f,0x02,0x7f,0x3f,0x3f,0x99,0x1f,0x02,0x3f,0x3f,0x7f,
+  0x04,0x17,0x23,0x00,0x01,0xa1,0x00,0x00,0x01,0x04,0x45,0x23,0x00,0x01,0xa1,0x00,
+  0x00,0x01,0x05,0x17,0x00,0x00,0x00,0x05,0x3a,0x00,0x00,0x00,0x05,0x45,0x00,0x00,
+  0x00,0x05,0x68,0x00,0x00,0x00,0xff,0x01,0x18,0x21,0x04,0x00,0x00,0x80,0xc0,0xc0,
+  0x97,0xe0,0x04,0xc0,0xc0,0x80,0x00,0x00,0x01,0x46,0x21,0x04,0x00,0x00,0x80,0xc0,
+  0xc0,0x97,0xe0,0x04,0xc0,0xc0,0x80,0x00,0x00,0x02,0x17,0x01,0x01,0xf8,0xfe,0x02,
+  0x39,0x01,0x01,0xfe,0xf8,0x02,0x45,0x01,0x01,0xf8,0xfe,0x02,0x67,0x01,0x01,0xfe,
+  0xf8,0x03,0x19,0x1f,0x9f,0xff,0x03,0x47,0x1f,0x9f,0xff,0x04,0x17,0x04,0x04,0x0f,
+  0x07,0x03,0x01,0x01,0x04,0x36,0x04,0x04,0x01,0x01,0x03,0x07,0x0f,0x04,0x45,0x04,
+  0x04,0x0f,0x07,0x03,0x01,0x01,0x04,0x64,0x04,0x04,0x01,0x01,0x03,0x07,0x0f,0xff,
+  0x01,0x1a,0x1d,0x02,0x00,0x80,0x80,0x97,0xc0,0x02,0x80,0x80,0x00,0x01,0x48,0x1d,
+  0x02,0x00,0x80,0x80,0x97,0xc0,0x02,0x80,0x80,0x00,0x02,0x17,0x02,0x02,0xf0,0xfc,
+  0xfe,0x02,0x38,0x02,0x02,0xfe,0xfc,0xf0,0x02,0x45,0x02,0x02,0xf0,0xfc,0xfe,0x02,
+  0x66,0x02,0x02,0xfe,0xfc,0xf0,0x04,0x17,0x23,0x04,0x1f,0x0f,0x07,0x03,0x03,0x99,
+  0x01,0x04,0x03,0x03,0x07,0x0f,0x1f,0x04,0x45,0x23,0x04,0x1f,0x0f,0x07,0x03,0x03,
+  0x99,0x01,0x04,0x03,0x03,0x07,0x0f,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x1b,0x1b,0x9b,0x00,0x01,0x4a,
+  0x1a,0x9a,0x00,0x02,0x17,0x1c,0x89,0x00,0x82,0x80,0x01,0xc0,0xc0,0x82,0xe0,0x82,
+  0xf0,0x82,0xf8,0x01,0xfc,0xfc,0x82,0xfe,0x02,0x4d,0x1b,0x82,0xfe,0x01,0xfc,0xfc,
+  0x82,0xf8,0x82,0xf0,0x82,0xe0,0x01,0xc0,0xc0,0x82,0x80,0x88,0x00,0x03,0x17,0x06,
+  0x00,0xf8,0x82,0xfc,0x82,0xfe,0x03,0x63,0x05,0x82,0xfe,0x82,0xfc,0x04,0x17,0x23,
+  0xa3,0xff,0x04,0x45,0x23,0xa3,0xff,0x05,0x17,0x23,0x01,0x0f,0x3f,0x82,0x7f,0x99,
+  0x3f,0x82,0x7f,0x01,0x3f,0x0f,0x05,0x45,0x23,0x01,0x0f,0x3f,0x82,0x7f,0x99,0x3f,
+  0x82,0x7f,0x01,0x3f,0x0f,0xff,0x01,0x49,0x00,0x00,0x00,0x02,0x21,0x14,0x84,0x00,
+  0x03,0x80,0x80,0xc0,0xc0,0x82,0xe0,0x05,0xf0,0xf0,0xf8,0xf8,0xfc,0xfc,0x82,0xfe,
+  0x02,0x4b,0x14,0x82,0xfe,0x05,0xfc,0xfc,0xf8,0xf8,0xf0,0xf0,0x82,0xe0,0x03,0xc0,
+  0xc0,0x80,0x80,0x84,0x00,0x03,0x17,0x0c,0x00,0xc0,0x82,0xe0,0x05,0xf0,0xf0,0xf8,
+  0xf8,0xfc,0xfc,0x82,0xfe,0x03,0x5d,0x0b,0x82,0xfe,0x05,0xfc,0xfc,0xf8,0xf8,0xf0,
+  0xf0,0x82,0xe0,0x05,0x1a,0x1d,0x9d,0xff,0x05,0x48,0x1d,0x9d,0xff,0x06,0x1b,0x1b,
+  0x9b,0x01,0x06,0x49,0x1b,0x9b,0x01,0xff,0x02,0x26,0x0d,0x02,0x00,0x80,0x80,0x82,
+  0xc0,0x07,0xe0,0xe0,0xf0,0xf0,0xf8,0xf8,0xfc,0xfc,0x02,0x4d,0x0d,0x07,0xfc,0xfc,
+  0xf8,0xf8,0xf0,0xf0,0xe0,0xe0,0x82,0xc0,0x02,0x80,0x80,0x00,0x03,0x17,0x0d,0x00,
+  0x80,0x82,0xc0,0x09,0xe0,0xe0,0xf0,0xf0,0xf8,0xf8,0xfc,0xfc,0xfe,0xfe,0x03,0x5c,
+  0x0c,0x09,0xfe,0xfe,0xfc,0xfc,0xf8,0xf8,0xf0,0xf0,0xe0,0xe0,0x82,0xc0,0x06,0x1d,
+  0x17,0x97,0x03,0x06,0x4b,0x17,0x97,0x03,0xff,0x02,0x27,0x02,0x02,0x00,0x80,0x80,
+  0x02,0x57,0x02,0x02,0x80,0x80,0x00,0x03,0x17,0x0e,0x0e,0x00,0x80,0x80,0xc0,0xc0,
+  0xe0,0xe0,0xf0,0xf0,0xf8,0xf8,0xfc,0xfc,0xfe,0xfe,0x03,0x5b,0x0d,0x0d,0xfe,0xfe,
+  0xfc,0xfc,0xf8,0xf8,0xf0,0xf0,0xe0,0xe0,0xc0,0xc0,0x80,0x80,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff
+};
@@ -0,0 +1,64 @@
+//***********************************************************************************************
+//  This example plays a pre-baked boot animation (closed, open, happy laugh, tired) and then
+//  continues with live Robo Eyes. The animation in boot_clip.h was recorded on a computer with
+//  extras/host/RoboEyes_ClipEncoder.cpp, so the board only copies the changed bytes of each
+//  frame to the display - no tweening and no drawing.
+//
+//  Hardware: You'll need a breadboard, an arduino nano r3, an I2C oled display with 1306   
+//  or 1309 chip and some jumper wires.
+//  
+//  Published in September 2024 by Dennis Hoelscher, FluxGarage
+//  www.youtube.com/@FluxGarage
+//  www.fluxgarage.com
+//
+//***********************************************************************************************
+
+
+#include <Adafruit_SSD1306.h>
+#include <FluxGarage_RoboEyes_SSD1306.h> // adds partial screen updates to Adafruit_SSD1306
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+// Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
+#define OLED_RESET     -1 // Reset pin # (or -1 if sharing Arduino reset pin)
+RoboEyes_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET); // only sends changed parts of the screen
+
+#include <FluxGarage_RoboEyes.h>
+#include <FluxGarage_RoboEyes_Clip.h>
+#include "boot_clip.h"
+roboEyes roboEyes; // create eyes
+RoboEyes_ClipPlayer<RoboEyes_SSD1306> player(display); // plays the boot animation
+
+bool booting = 1;
+
+
+void setup() {
+  // OLED Display
+  // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
+  if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) { // Address 0x3C or 0x3D
+    Serial.println(F("SSD1306 allocation failed"));
+    for(;;); // Don't proceed, loop forever
+  }
+
+  // Startup robo eyes
+  roboEyes.begin(SCREEN_WIDTH, SCREEN_HEIGHT, 50); // screen-width, screen-height, max framerate
+  roboEyes.setMood(TIRED); // continue with the expression the clip ends with
+  roboEyes.setAutoblinker(ON, 3, 2);
+
+  player.play(bootClip); // start the boot animation
+
+} // end of setup
+
+
+void loop() {
+  if(player.isPlaying()){
+    player.update(); // show the next frame of the boot animation
+  } else {
+    if(booting){
+      booting = 0;
+      roboEyes.forceFullRedraw(); // replace the last clip frame
+    }
+    roboEyes.update(); // update eyes drawings
+  }
+
+} // end of main loop
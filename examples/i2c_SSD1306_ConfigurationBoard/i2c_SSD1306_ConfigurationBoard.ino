@@ -14,12 +14,13 @@
 //***********************************************************************************************
 
 #include <Adafruit_SSD1306.h>
+#include <FluxGarage_RoboEyes_SSD1306.h> // adds partial screen updates to Adafruit_SSD1306
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 // Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
 #define OLED_RESET     -1 // Reset pin # (or -1 if sharing Arduino reset pin)
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+RoboEyes_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET); // only sends changed parts of the screen
 
 #include <FluxGarage_RoboEyes.h>
 roboEyes roboEyes; // create eyes
@@ -98,19 +99,19 @@ void loop() {
     display.setCursor(0,3);
     if(configMode == EYES_WIDTHS){
       display.println("Widths"); 
-      display.println(roboEyes.eyeLwidthCurrent);
+      display.println(roboEyes.eyeLwidthCurrent());
       }
     else if(configMode == EYES_HEIGHTS){
       display.println("Heights"); 
-      display.println(roboEyes.eyeLheightCurrent);
+      display.println(roboEyes.eyeLheightCurrent());
       }
     else if(configMode == EYES_BORDERRADIUS){
       display.println("Border \nRadius"); 
-      display.println(roboEyes.eyeLborderRadiusCurrent);
+      display.println(roboEyes.eyeLborderRadiusCurrent());
       }
     else if(configMode == EYES_SPACEBETWEEN){
       display.println("Space \nBetween"); 
-      display.println(roboEyes.spaceBetweenCurrent);
+      display.println(roboEyes.spaceBetweenCurrent());
       }
     else if(configMode == CYCLOPS_TOGGLE){
       display.println("Cyclops \nToggle");
@@ -124,6 +125,7 @@ void loop() {
       roboEyes.setPosition(DEFAULT); // start with middle centered eyes
       }
     display.display(); // additionally show configMode on display
+    roboEyes.forceFullRedraw(); // text covers the whole screen, so the next eyes frame has to replace everything
     if(millis() >= showConfigModeTimer+showConfigModeDuration){
       showConfigMode = 0; // don't show the current config mode on the screen anymore
     }
@@ -142,8 +144,8 @@ void loop() {
 void readJoystick(){
   int joystickX = analogRead(joystickXpin);
   int joystickY = analogRead(joystickYpin);
-  roboEyes.eyeLxNext = map(joystickX, 0, 1023, 0, roboEyes.getScreenConstraint_X() );
-  roboEyes.eyeLyNext = map(joystickY, 0, 1023, 0, roboEyes.getScreenConstraint_Y() );
+  // Gaze from -32768 to 32767, the eyes are only redrawn when they move by at least one pixel
+  roboEyes.setGaze(map(joystickX, 0, 1023, -32768, 32767), map(joystickY, 0, 1023, -32768, 32767));
 } // end of readJoystick
 
 
@@ -186,42 +188,44 @@ void readButtons(){
   }
   if (buttonIncrement.getSingleDebouncedPress()){
     showConfigMode = 0; // don't show the current config mode on the screen anymore
-    if(configMode == EYES_WIDTHS){roboEyes.eyeLwidthNext++; roboEyes.eyeRwidthNext++;}
-    else if(configMode == EYES_HEIGHTS){roboEyes.eyeLheightNext++; roboEyes.eyeRheightNext++; roboEyes.eyeLheightDefault++; roboEyes.eyeRheightDefault++;}
+    if(configMode == EYES_WIDTHS){roboEyes.eyeLwidthNext()++; roboEyes.eyeRwidthNext()++;}
+    else if(configMode == EYES_HEIGHTS){roboEyes.eyeLheightNext()++; roboEyes.eyeRheightNext()++; roboEyes.eyeLheightDefault++; roboEyes.eyeRheightDefault++;}
     else if(configMode == EYES_BORDERRADIUS){
-      if(roboEyes.eyeLborderRadiusNext<50){roboEyes.eyeLborderRadiusNext++;}
-      if(roboEyes.eyeRborderRadiusNext<50){roboEyes.eyeRborderRadiusNext++;}
+      if(roboEyes.eyeLborderRadiusNext()<50){roboEyes.eyeLborderRadiusNext()++;}
+      if(roboEyes.eyeRborderRadiusNext()<50){roboEyes.eyeRborderRadiusNext()++;}
       }
-    else if(configMode == EYES_SPACEBETWEEN){roboEyes.spaceBetweenNext++;}
+    else if(configMode == EYES_SPACEBETWEEN){roboEyes.spaceBetweenNext()++;}
     else if(configMode == CYCLOPS_TOGGLE){roboEyes.setCyclops(OFF);} // no cyclops mode
     else if(configMode == CURIOUS_TOGGLE){roboEyes.setCuriosity(ON);} // curious mode
     else if(configMode == PREDEFINED_POSITIONS){
       if (position<8){position++;} else{position=0;}
       updatePosition();
     }
+    roboEyes.wake(); // eye geometry was changed directly, so make sure the eyes get redrawn
   }
   if (buttonDecrement.getSingleDebouncedPress()){
     showConfigMode = 0; // don't show the current config mode on the screen anymore
-    if(configMode == EYES_WIDTHS){roboEyes.eyeLwidthNext--; roboEyes.eyeRwidthNext--;}
-    else if(configMode == EYES_HEIGHTS){roboEyes.eyeLheightNext--; roboEyes.eyeRheightNext--; roboEyes.eyeLheightDefault--; roboEyes.eyeRheightDefault--;}
+    if(configMode == EYES_WIDTHS){roboEyes.eyeLwidthNext()--; roboEyes.eyeRwidthNext()--;}
+    else if(configMode == EYES_HEIGHTS){roboEyes.eyeLheightNext()--; roboEyes.eyeRheightNext()--; roboEyes.eyeLheightDefault--; roboEyes.eyeRheightDefault--;}
     else if(configMode == EYES_BORDERRADIUS){
-      if(roboEyes.eyeLborderRadiusNext>0){roboEyes.eyeLborderRadiusNext--;}
-      if(roboEyes.eyeRborderRadiusNext>0){roboEyes.eyeRborderRadiusNext--;}
+      if(roboEyes.eyeLborderRadiusNext()>0){roboEyes.eyeLborderRadiusNext()--;}
+      if(roboEyes.eyeRborderRadiusNext()>0){roboEyes.eyeRborderRadiusNext()--;}
       }
-    else if(configMode == EYES_SPACEBETWEEN){roboEyes.spaceBetweenNext--;}
+    else if(configMode == EYES_SPACEBETWEEN){roboEyes.spaceBetweenNext()--;}
     else if(configMode == CYCLOPS_TOGGLE){roboEyes.setCyclops(ON);} // cyclops mode
     else if(configMode == CURIOUS_TOGGLE){roboEyes.setCuriosity(OFF);} // no curious mode
     else if(configMode == PREDEFINED_POSITIONS){
       if (position>0){position--;} else{position=8;}
       updatePosition();
     }
+    roboEyes.wake(); // eye geometry was changed directly, so make sure the eyes get redrawn
   }
 
   // JOYSTICK BUTTON
   // toggles between joystick controlled eye position and idle animation (eyes looking in random directions)
   if (buttonJoystick.getSingleDebouncedPress()){
     joystickToggle = !joystickToggle;
-    roboEyes.idle = !roboEyes.idle;
+    roboEyes.setIdleMode(!roboEyes.idle);
   }
 
 
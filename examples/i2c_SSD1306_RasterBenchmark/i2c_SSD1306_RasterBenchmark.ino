@@ -0,0 +1,151 @@
+//***********************************************************************************************
+//  This example compares the drawing speed of the Adafruit GFX methods with the RoboEyes raster,
+//  which draws the eye shapes directly into the display buffer, shape by shape or handed to its
+//  compositor as layers (the default of RoboEyes). All three draw the same eyes with tired and
+//  happy eyelids, results are printed to the serial monitor (9600 baud).
+//
+//  Hardware: You'll need a breadboard, an arduino nano r3, an I2C oled display with 1306   
+//  or 1309 chip and some jumper wires.
+//  
+//  Published in September 2024 by Dennis Hoelscher, FluxGarage
+//  www.youtube.com/@FluxGarage
+//  www.fluxgarage.com
+//
+//***********************************************************************************************
+
+
+#include <Adafruit_SSD1306.h>
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+// Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
+#define OLED_RESET     -1 // Reset pin # (or -1 if sharing Arduino reset pin)
+Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+
+#include <FluxGarage_RoboEyes_Raster.h>
+
+#define FRAMES 200 // number of frames drawn per method
+
+// Eye geometry used for both methods
+int eyeX = 23;
+int eyeY = 14;
+int eyeWidth = 36;
+int eyeHeight = 36;
+int eyeSpace = 10;
+byte borderRadius = 8;
+byte lidHeight = 12;
+byte happyOffset = 10;
+
+// Corner tables of the eyes and happy eyelids for the compositor
+uint8_t eyeInset[ROBOEYES_MAX_RADIUS];
+uint8_t happyInset[ROBOEYES_MAX_RADIUS];
+
+
+void setup() {
+  Serial.begin(9600);
+
+  // Startup OLED Display
+  // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
+  if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) { // Address 0x3C or 0x3D
+    Serial.println(F("SSD1306 allocation failed"));
+    for(;;); // Don't proceed, loop forever
+  }
+
+  // Adafruit GFX
+  unsigned long gfxTimer = micros();
+  for(int i=0; i<FRAMES; i++){
+    drawFrameGFX();
+  }
+  gfxTimer = micros()-gfxTimer;
+  unsigned long gfxChecksum = bufferChecksum();
+
+  // RoboEyes raster
+  unsigned long rasterTimer = micros();
+  for(int i=0; i<FRAMES; i++){
+    drawFrameRaster();
+  }
+  rasterTimer = micros()-rasterTimer;
+  unsigned long rasterChecksum = bufferChecksum();
+
+  // RoboEyes compositor
+  RoboEyes_Raster::cornerInsets(RoboEyes_Raster::roundRectRadius(eyeWidth, eyeHeight, borderRadius), eyeInset);
+  RoboEyes_Raster::cornerInsets(RoboEyes_Raster::roundRectRadius(eyeWidth+2, eyeHeight, borderRadius), happyInset);
+  unsigned long composeTimer = micros();
+  for(int i=0; i<FRAMES; i++){
+    drawFrameCompose();
+  }
+  composeTimer = micros()-composeTimer;
+  unsigned long composeChecksum = bufferChecksum();
+
+  Serial.print(F("GFX:     "));
+  Serial.print(gfxTimer/FRAMES);
+  Serial.println(F(" us per frame"));
+  Serial.print(F("Raster:  "));
+  Serial.print(rasterTimer/FRAMES);
+  Serial.println(F(" us per frame"));
+  Serial.print(F("Compose: "));
+  Serial.print(composeTimer/FRAMES);
+  Serial.println(F(" us per frame"));
+  Serial.println(gfxChecksum == rasterChecksum && gfxChecksum == composeChecksum ? F("Identical pixels") : F("Pixels differ!"));
+
+  display.display(); // show the eyes drawn by the compositor
+} // end of setup
+
+
+void loop() {
+}
+
+
+// Draw both eyes with the Adafruit GFX methods
+void drawFrameGFX(){
+  int eyeRx = eyeX+eyeWidth+eyeSpace;
+  display.clearDisplay();
+  display.fillRoundRect(eyeX, eyeY, eyeWidth, eyeHeight, borderRadius, SSD1306_WHITE);
+  display.fillRoundRect(eyeRx, eyeY, eyeWidth, eyeHeight, borderRadius, SSD1306_WHITE);
+  display.fillTriangle(eyeX, eyeY-1, eyeX+eyeWidth, eyeY-1, eyeX, eyeY+lidHeight-1, SSD1306_BLACK);
+  display.fillTriangle(eyeRx, eyeY-1, eyeRx+eyeWidth, eyeY-1, eyeRx+eyeWidth, eyeY+lidHeight-1, SSD1306_BLACK);
+  display.fillRoundRect(eyeX-1, eyeY+eyeHeight-happyOffset+1, eyeWidth+2, eyeHeight, borderRadius, SSD1306_BLACK);
+  display.fillRoundRect(eyeRx-1, eyeY+eyeHeight-happyOffset+1, eyeWidth+2, eyeHeight, borderRadius, SSD1306_BLACK);
+} // end of drawFrameGFX
+
+
+// Draw the same eyes with the RoboEyes raster
+void drawFrameRaster(){
+  int eyeRx = eyeX+eyeWidth+eyeSpace;
+  RoboEyes_Raster raster(display.getBuffer(), SCREEN_WIDTH, SCREEN_HEIGHT);
+  display.clearDisplay();
+  raster.fillRoundRect(eyeX, eyeY, eyeWidth, eyeHeight, borderRadius, SSD1306_WHITE);
+  raster.fillRoundRect(eyeRx, eyeY, eyeWidth, eyeHeight, borderRadius, SSD1306_WHITE);
+  raster.fillTriangle(eyeX, eyeY-1, eyeX+eyeWidth, eyeY-1, eyeX, eyeY+lidHeight-1, SSD1306_BLACK);
+  raster.fillTriangle(eyeRx, eyeY-1, eyeRx+eyeWidth, eyeY-1, eyeRx+eyeWidth, eyeY+lidHeight-1, SSD1306_BLACK);
+  raster.fillRoundRect(eyeX-1, eyeY+eyeHeight-happyOffset+1, eyeWidth+2, eyeHeight, borderRadius, SSD1306_BLACK);
+  raster.fillRoundRect(eyeRx-1, eyeY+eyeHeight-happyOffset+1, eyeWidth+2, eyeHeight, borderRadius, SSD1306_BLACK);
+} // end of drawFrameRaster
+
+
+// Draw the same eyes as layers with the RoboEyes compositor, which writes every byte of the region once
+void drawFrameCompose(){
+  int eyeRx = eyeX+eyeWidth+eyeSpace;
+  byte radius = RoboEyes_Raster::roundRectRadius(eyeWidth, eyeHeight, borderRadius);
+  byte radiusHappy = RoboEyes_Raster::roundRectRadius(eyeWidth+2, eyeHeight, borderRadius);
+  RoboEyes_Layer layers[6];
+  layers[0] = RoboEyes_Raster::layer(ROBOEYES_LAYER_EYE, eyeX, eyeY, eyeWidth, eyeHeight, radius, eyeInset);
+  layers[1] = RoboEyes_Raster::layer(ROBOEYES_LAYER_EYE, eyeRx, eyeY, eyeWidth, eyeHeight, radius, eyeInset);
+  layers[2] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeX, eyeY-1, eyeX+eyeWidth, lidHeight, 0, 0); // x = corner with the vertical edge, w = other top corner
+  layers[3] = RoboEyes_Raster::layer(ROBOEYES_LAYER_LID, eyeRx+eyeWidth, eyeY-1, eyeRx, lidHeight, 0, 0);
+  layers[4] = RoboEyes_Raster::layer(ROBOEYES_LAYER_CUTOUT, eyeX-1, eyeY+eyeHeight-happyOffset+1, eyeWidth+2, eyeHeight, radiusHappy, happyInset);
+  layers[5] = RoboEyes_Raster::layer(ROBOEYES_LAYER_CUTOUT, eyeRx-1, eyeY+eyeHeight-happyOffset+1, eyeWidth+2, eyeHeight, radiusHappy, happyInset);
+  RoboEyes_Raster raster(display.getBuffer(), SCREEN_WIDTH, SCREEN_HEIGHT);
+  raster.compose(0, SCREEN_WIDTH-1, 0, (SCREEN_HEIGHT-1)/8, layers, 6);
+} // end of drawFrameCompose
+
+
+// Simple checksum of the display buffer, for comparing the results of both methods
+unsigned long bufferChecksum(){
+  uint8_t *buffer = display.getBuffer();
+  unsigned long checksum = 0;
+  for(int i=0; i<SCREEN_WIDTH*((SCREEN_HEIGHT+7)/8); i++){
+    checksum = (checksum << 1 | checksum >> 31) ^ buffer[i];
+  }
+  return checksum;
+} // end of bufferChecksum
@@ -0,0 +1,59 @@
+//***********************************************************************************************
+//  This example plays the same looped animation as the AnimationSequences example, but as a
+//  sequence stored in flash memory. The sequence is run by roboEyes.update(), so loop() stays
+//  free for your own code and no timers or flag variables are needed.
+//
+//  Hardware: You'll need a breadboard, an arduino nano r3, an I2C oled display with 1306   
+//  or 1309 chip and some jumper wires.
+//  
+//  Published in September 2024 by Dennis Hoelscher, FluxGarage
+//  www.youtube.com/@FluxGarage
+//  www.fluxgarage.com
+//
+//***********************************************************************************************
+
+
+#include <Adafruit_SSD1306.h>
+#include <FluxGarage_RoboEyes_SSD1306.h> // adds partial screen updates to Adafruit_SSD1306
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+// Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
+#define OLED_RESET     -1 // Reset pin # (or -1 if sharing Arduino reset pin)
+RoboEyes_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET); // only sends changed parts of the screen
+
+#include <FluxGarage_RoboEyes.h>
+roboEyes roboEyes; // create eyes
+
+// ANIMATION SEQUENCE, waits are in milliseconds after the previous wait
+const uint8_t sequence[] PROGMEM = {
+  SEQ_CLOSE, // start with closed eyes
+  SEQ_MARK, // the looped part starts here
+  SEQ_WAIT(2000), SEQ_OPEN, // open eyes
+  SEQ_WAIT(2000), SEQ_MOOD(HAPPY), SEQ_LAUGH, // happy and laughing
+  SEQ_WAIT(2000), SEQ_MOOD(TIRED),
+  SEQ_WAIT(2000), SEQ_CLOSE, SEQ_MOOD(DEFAULT), // close eyes again
+  SEQ_LOOP(0) // repeat from SEQ_MARK forever, SEQ_LOOP(3) would play the looped part 3 times
+};
+
+
+void setup() {
+  // OLED Display
+  // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
+  if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) { // Address 0x3C or 0x3D
+    Serial.println(F("SSD1306 allocation failed"));
+    for(;;); // Don't proceed, loop forever
+  }
+
+  // Startup robo eyes
+  roboEyes.begin(SCREEN_WIDTH, SCREEN_HEIGHT, 100); // screen-width, screen-height, max framerate - 60-100fps are good for smooth animations
+  roboEyes.setPosition(DEFAULT); // eye position should be middle center
+  roboEyes.playSequence(sequence); // start the animation sequence
+
+} // end of setup
+
+
+void loop() {
+ roboEyes.update(); // update eyes drawings and play the sequence
+
+} // end of main loop
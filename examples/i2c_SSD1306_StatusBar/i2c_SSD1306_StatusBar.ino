@@ -0,0 +1,73 @@
+//***********************************************************************************************
+//  This example shows how the eyes share the display with other content: the eyes are limited
+//  to a viewport below a status bar. RoboEyes only clears, draws and sends the viewport, so the
+//  status bar is left as it is and only updated once per second, when its text changes.
+//
+//  Hardware: You'll need a breadboard, an arduino nano r3, an I2C oled display with 1306
+//  or 1309 chip and some jumper wires.
+//
+//  Published in September 2024 by Dennis Hoelscher, FluxGarage
+//  www.youtube.com/@FluxGarage
+//  www.fluxgarage.com
+//
+//***********************************************************************************************
+
+
+#include <Adafruit_SSD1306.h>
+#include <FluxGarage_RoboEyes_SSD1306.h> // adds partial screen updates to Adafruit_SSD1306
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+#define STATUS_HEIGHT 16 // status bar height, in pixels (two pages of 8 rows)
+// Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
+#define OLED_RESET     -1 // Reset pin # (or -1 if sharing Arduino reset pin)
+RoboEyes_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET); // only sends changed parts of the screen
+
+#include <FluxGarage_RoboEyes.h>
+roboEyes roboEyes; // create RoboEyes instance
+
+unsigned long statusTimer = 0; // time of the next status bar update
+
+
+void setup() {
+  Serial.begin(9600);
+
+  // Startup OLED Display
+  // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
+  if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) { // Address 0x3C or 0x3D
+    Serial.println(F("SSD1306 allocation failed"));
+    for(;;); // Don't proceed, loop forever
+  }
+
+  // Startup robo eyes
+  roboEyes.begin(SCREEN_WIDTH, SCREEN_HEIGHT, 100); // screen-width, screen-height, max framerate
+
+  // Eyes below the status bar -> x, y, width, height of the viewport on the display
+  roboEyes.setViewport(0, STATUS_HEIGHT, SCREEN_WIDTH, SCREEN_HEIGHT-STATUS_HEIGHT);
+  roboEyes.setHeight(32, 32); // fit the eyes into the 48 pixel rows of the viewport
+  roboEyes.setPosition(DEFAULT); // positions are relative to the viewport
+
+  // Define some automated eyes behaviour
+  roboEyes.setAutoblinker(ON, 3, 2); // Start auto blinker animation cycle -> bool active, int interval, int variation -> turn on/off, set interval between each blink in full seconds, set range for random interval variation in full seconds
+  roboEyes.setIdleMode(ON, 2, 2); // Start idle animation cycle (eyes looking in random directions) -> turn on/off, set interval between each eye repositioning in full seconds, set range for random time interval variation in full seconds
+
+  display.setTextSize(1);
+  display.setTextColor(SSD1306_WHITE);
+
+} // end of setup
+
+
+void loop() {
+  roboEyes.update(); // update eyes drawings, only inside the viewport
+
+  // Update the status bar once per second and send only its two pages
+  if(millis() >= statusTimer){
+    statusTimer = millis()+1000;
+    display.fillRect(0, 0, SCREEN_WIDTH, STATUS_HEIGHT, SSD1306_BLACK);
+    display.setCursor(0, 4);
+    display.print("Uptime ");
+    display.print(millis()/1000);
+    display.print("s");
+    display.displayRegion(0, SCREEN_WIDTH-1, 0, STATUS_HEIGHT/8-1); // columns, first and last page
+  }
+}
@@ -0,0 +1,183 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Simulation of the asynchronous flush (RoboEyes::setAsyncFlush()) on a desktop computer.
+ *
+ * A simulated slow display bus (default 25 microseconds per byte, like I2C at 400kHz)
+ * runs in its own thread and copies the transmitted bytes into a simulated display memory.
+ * The same animation runs twice in real time, first with blocking flushes and then with
+ * the asynchronous flush, and the longest update() call of both runs is reported. At the
+ * end of each run, the simulated display memory must equal the display buffer.
+ *
+ * Build and run on Linux (from this directory):
+ *   g++ -std=c++11 -O2 -pthread -I../.. RoboEyes_AsyncFlush.cpp -o roboeyes_async
+ *   ./roboeyes_async [seconds] [microseconds per byte]
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "FluxGarage_RoboEyes_Framebuffer.h"
+#include "FluxGarage_RoboEyes.h"
+
+static unsigned long microsPerByte = 25;
+
+// Simulated display memory, written by the blocking display and by the transport thread
+static uint8_t panel[128*64/8];
+
+static void transmit(const uint8_t *buffer, int16_t width, int16_t x0, int16_t x1, uint8_t page0, uint8_t page1) {
+  unsigned int bytes = (x1-x0+1)*(page1-page0+1);
+  std::this_thread::sleep_for(std::chrono::microseconds(bytes*microsPerByte));
+  for(uint8_t page = page0; page <= page1; page++){
+    memcpy(panel + page*width + x0, buffer + page*width + x0, x1-x0+1);
+  }
+}
+
+// Display whose transmissions block for the simulated bus time
+class SlowDisplay : public RoboEyes_Framebuffer<128, 64>
+{
+public:
+
+void display() {
+  transmit(buffer, 128, 0, 127, 0, 7);
+}
+unsigned int displayRegion(int16_t x0, int16_t x1, uint8_t page0, uint8_t page1) {
+  transmit(buffer, 128, x0, x1, page0, page1);
+  return (x1-x0+1)*(page1-page0+1);
+}
+
+}; // end of class SlowDisplay
+
+// Transport sending in a separate thread, like a DMA channel would
+class ThreadTransport : public RoboEyes_Transport
+{
+public:
+
+std::thread worker;
+std::mutex mutex;
+std::condition_variable wakeup;
+std::atomic<bool> active;
+bool quit = 0;
+const uint8_t *buffer = 0;
+int16_t width = 0;
+int16_t x0 = 0, x1 = 0;
+uint8_t page0 = 0, page1 = 0;
+
+ThreadTransport() : active(false) {
+  worker = std::thread(&ThreadTransport::run, this);
+}
+~ThreadTransport() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    quit = 1;
+  }
+  wakeup.notify_one();
+  worker.join();
+}
+
+void send(const uint8_t *data, int16_t dataWidth, int16_t windowX0, int16_t windowX1, uint8_t windowPage0, uint8_t windowPage1) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    buffer = data; width = dataWidth;
+    x0 = windowX0; x1 = windowX1; page0 = windowPage0; page1 = windowPage1;
+    active = true;
+  }
+  wakeup.notify_one();
+}
+
+bool busy() {
+  return active;
+}
+
+void run() {
+  std::unique_lock<std::mutex> lock(mutex);
+  while(1){
+    wakeup.wait(lock, [this]{ return active || quit; });
+    if(quit){return;}
+    lock.unlock();
+    transmit(buffer, width, x0, x1, page0, page1);
+    lock.lock();
+    active = false;
+  }
+}
+
+}; // end of class ThreadTransport
+
+struct Result {
+  unsigned long updates;
+  unsigned long frames;
+  unsigned long longestUpdate; // microseconds
+  unsigned int missed;
+  bool panelMatches;
+};
+
+static Result run(unsigned long seconds, bool async) {
+  static SlowDisplay display;
+  static uint8_t front[sizeof(display.buffer)];
+  RoboEyes<SlowDisplay> eyes(display);
+  ThreadTransport transport;
+  Result result;
+  memset(&result, 0, sizeof(result));
+  memset(panel, 0, sizeof(panel));
+  eyes.begin(128, 64, 50);
+  if(async){eyes.setAsyncFlush(&transport, front);}
+  eyes.setAutoblinker(ON, 1, 1);
+  eyes.setIdleMode(ON, 1, 1);
+  eyes.setHFlicker(ON, 2);
+  unsigned long start = millis();
+  unsigned long lastFrame = eyes.fpsTimer;
+  while(millis()-start < seconds*1000){
+    unsigned long before = micros();
+    eyes.update();
+    unsigned long duration = micros()-before;
+    if(duration > result.longestUpdate){result.longestUpdate = duration;}
+    if(eyes.fpsTimer != lastFrame){lastFrame = eyes.fpsTimer; result.frames++;}
+    result.updates++;
+  }
+  // Let the last frame reach the display
+  eyes.setHFlicker(OFF, 0);
+  eyes.setAutoblinker(OFF, 0, 0);
+  eyes.setIdleMode(OFF, 0, 0);
+  while(eyes.isAnimating() || transport.busy()){
+    eyes.update();
+  }
+  result.missed = eyes.getMissedFrames();
+  result.panelMatches = !memcmp(panel, display.getBuffer(), sizeof(panel));
+  return result;
+}
+
+int main(int argc, char **argv) {
+  unsigned long seconds = (argc > 1) ? atol(argv[1]) : 3;
+  if(argc > 2){microsPerByte = atol(argv[2]);}
+  bool ok = 1;
+  printf("mode,updates,frames,longest_update_us,missed_frames,panel_matches\n");
+  for(int async = 0; async <= 1; async++){
+    Result r = run(seconds, async);
+    printf("%s,%lu,%lu,%lu,%u,%s\n", async ? "async" : "blocking", r.updates, r.frames, r.longestUpdate, r.missed, r.panelMatches ? "yes" : "no");
+    ok = ok && r.panelMatches;
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,293 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Headless batch renderer for previewing expressions on a desktop computer.
+ *
+ * Renders every combination of the given eye widths, heights, border radii, spaces,
+ * moods and positions into an in-memory 128x64 (or 240x240) frame buffer, from closed eyes until the
+ * eyes came to rest, in simulated time. Prints a checksum of every frame as CSV, and
+ * optionally writes every frame as PBM image, draws every frame with the native raster and
+ * with the display's drawing methods (GFX path) and compares them pixel by pixel, and
+ * compares the checksums to a golden file from an earlier run.
+ *
+ * Build and run on Linux (from this directory):
+ *   g++ -std=c++11 -O2 -I../.. RoboEyes_BatchRender.cpp -o roboeyes_render
+ *   ./roboeyes_render --width 20:40:4 --radius 0:12:4 --mood all > checksums.csv
+ *   ./roboeyes_render --mood happy --position all --out frames     PBM images in frames/
+ *   ./roboeyes_render --radius 0:18 --space -10:20:2 --compare     native raster vs. GFX path
+ *   ./roboeyes_render --screen 240x240 --width 60:100:20 --height 60:100:20 --radius 0:50:5 --space 10 --mood all --compare
+ *                                                                   large eyes and radii on a 240x240 screen
+ *   ./roboeyes_render --mood all --golden golden.csv               writes golden.csv, or compares to it
+ * Ranges are first:last[:step]. An animated preview can be made from the images, e.g. with
+ * ImageMagick: convert -delay 2 frames/w36_h36_r8_s10_happy_default_*.pbm happy.gif
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "FluxGarage_RoboEyes_Framebuffer.h"
+#include "FluxGarage_RoboEyes.h"
+
+#define MAX_FRAMES 1000 // per variant, in case the eyes never come to rest
+
+struct Range {
+  int first, last, step;
+};
+
+struct Named {
+  const char *name;
+  unsigned char value;
+};
+
+static const Named moods[] = {{"default", DEFAULT}, {"tired", TIRED}, {"angry", ANGRY}, {"happy", HAPPY}};
+static const Named positions[] = {{"default", DEFAULT}, {"n", N}, {"ne", NE}, {"e", E}, {"se", SE}, {"s", S}, {"sw", SW}, {"w", W}, {"nw", NW}};
+
+// Parse first:last[:step]
+static bool parseRange(const char *text, Range &range) {
+  range.step = 1;
+  int fields = sscanf(text, "%d:%d:%d", &range.first, &range.last, &range.step);
+  if(fields == 1){range.last = range.first;}
+  return fields >= 1 && range.step > 0 && range.last >= range.first;
+}
+
+// Parse a comma separated list of names, or "all"
+static bool parseList(const char *text, const Named *names, int count, std::vector<Named> &list) {
+  list.clear();
+  if(!strcmp(text, "all")){
+    list.assign(names, names+count);
+    return true;
+  }
+  std::string rest = text;
+  while(!rest.empty()){
+    size_t comma = rest.find(',');
+    std::string item = rest.substr(0, comma);
+    rest = (comma == std::string::npos) ? "" : rest.substr(comma+1);
+    int i = 0;
+    while(i < count && item != names[i].name){i++;}
+    if(i == count){return false;}
+    list.push_back(names[i]);
+  }
+  return !list.empty();
+}
+
+// FNV-1a over the frame buffer
+static uint32_t checksum(const uint8_t *data, unsigned int size) {
+  uint32_t hash = 2166136261u;
+  for(unsigned int i = 0; i < size; i++){
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// Binary PBM, dark eyes on white like a printout. Returns false if the file can't be written.
+template<class Display>
+static bool writePbm(const char *path, const Display &display) {
+  FILE *file = fopen(path, "wb");
+  if(!file){return false;}
+  fprintf(file, "P4\n%d %d\n", display.width(), display.height());
+  for(int y = 0; y < display.height(); y++){
+    for(int x = 0; x < display.width(); x += 8){
+      uint8_t bits = 0;
+      for(int i = 0; i < 8; i++){
+        bits = (bits << 1) | display.getPixel(x+i, y);
+      }
+      fputc(bits, file);
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+// First differing pixel of two frames, returns false if they are identical
+template<class Display>
+static bool firstDifference(const Display &a, const Display &b, int &x, int &y) {
+  for(y = 0; y < a.height(); y++){
+    for(x = 0; x < a.width(); x++){
+      if(a.getPixel(x, y) != b.getPixel(x, y)){return true;}
+    }
+  }
+  return false;
+}
+
+template<class Display>
+static void setup(RoboEyes<Display> &eyes, bool native, int width, int height, int radius, int space, const Named &mood, const Named &position) {
+  eyes.begin(eyes.display.width(), eyes.display.height(), 50);
+  eyes.setNativeRaster(native);
+  eyes.setWidth(width, width);
+  eyes.setHeight(height, height);
+  eyes.setBorderradius(radius, radius);
+  eyes.setSpacebetween(space);
+  eyes.setMood(mood.value);
+  eyes.setPosition(position.value);
+}
+
+struct Options {
+  Range widths, heights, radii, spaces;
+  std::vector<Named> moodList, positionList;
+  const char *out;
+  const char *golden;
+  bool compare;
+};
+
+// Render all variants on a Display sized screen, returns the exit code
+template<class Display>
+static int render(const Options &options) {
+  const Range &widths = options.widths, &heights = options.heights, &radii = options.radii, &spaces = options.spaces;
+  const std::vector<Named> &moodList = options.moodList, &positionList = options.positionList;
+  const char *out = options.out;
+  const char *golden = options.golden;
+  bool compare = options.compare;
+
+  // Golden checksums of an earlier run, if the file exists
+  std::map<std::string, std::string> goldenSums;
+  FILE *goldenFile = golden ? fopen(golden, "r") : 0;
+  bool writeGolden = golden && !goldenFile;
+  if(goldenFile){
+    char line[256];
+    while(fgets(line, sizeof(line), goldenFile)){
+      std::string entry = line;
+      size_t comma = entry.rfind(','); // variant,frame,checksum
+      if(comma == std::string::npos){continue;}
+      goldenSums[entry.substr(0, comma)] = entry.substr(comma+1, 8);
+    }
+    fclose(goldenFile);
+  }
+  if(writeGolden){
+    goldenFile = fopen(golden, "w");
+    if(!goldenFile){
+      fprintf(stderr, "can't write %s\n", golden);
+      return 1;
+    }
+  }
+
+  static Display display, reference;
+  RoboEyes<Display> eyes(display);
+  RoboEyes<Display> gfxEyes(reference);
+  roboEyesHostSimulation() = 1;
+  unsigned long variants = 0, frames = 0, differences = 0, goldenMismatches = 0, goldenMissing = 0;
+  double seconds = 0;
+
+  printf("variant,frame,checksum\n");
+  for(int width = widths.first; width <= widths.last; width += widths.step)
+  for(int height = heights.first; height <= heights.last; height += heights.step)
+  for(int radius = radii.first; radius <= radii.last; radius += radii.step)
+  for(int space = spaces.first; space <= spaces.last; space += spaces.step)
+  for(size_t m = 0; m < moodList.size(); m++)
+  for(size_t p = 0; p < positionList.size(); p++){
+    char variant[128];
+    snprintf(variant, sizeof(variant), "w%d_h%d_r%d_s%d_%s_%s", width, height, radius, space, moodList[m].name, positionList[p].name);
+    variants++;
+    roboEyesHostSimulatedMillis() = 1;
+    setup(eyes, 1, width, height, radius, space, moodList[m], positionList[p]);
+    if(compare){setup(gfxEyes, 0, width, height, radius, space, moodList[m], positionList[p]);}
+    bool reported = 0;
+    for(int frame = 0; frame < MAX_FRAMES && eyes.isAnimating(); frame++){
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      eyes.drawEyes();
+      seconds += std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+      frames++;
+      char key[160], sum[16];
+      snprintf(key, sizeof(key), "%s,%04d", variant, frame);
+      snprintf(sum, sizeof(sum), "%08x", (unsigned int)checksum(display.buffer, sizeof(display.buffer)));
+      printf("%s,%s\n", key, sum);
+      if(writeGolden){fprintf(goldenFile, "%s,%s\n", key, sum);}
+      if(golden && !writeGolden){
+        std::map<std::string, std::string>::const_iterator entry = goldenSums.find(key);
+        if(entry == goldenSums.end()){goldenMissing++;}
+        else if(entry->second != sum){
+          if(!goldenMismatches){fprintf(stderr, "first golden mismatch: %s\n", key);}
+          goldenMismatches++;
+        }
+      }
+      if(out){
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s_%04d.pbm", out, variant, frame);
+        if(!writePbm(path, display)){
+          fprintf(stderr, "can't write %s\n", path);
+          return 1;
+        }
+      }
+      if(compare){
+        gfxEyes.drawEyes();
+        int x, y;
+        if(firstDifference(display, reference, x, y)){
+          differences++;
+          if(!reported){fprintf(stderr, "native and gfx differ: %s frame %d, first at x %d y %d\n", variant, frame, x, y);}
+          reported = 1;
+        }
+      }
+      roboEyesHostSimulatedMillis() += eyes.frameInterval;
+    }
+  }
+  if(writeGolden){fclose(goldenFile);}
+
+  fprintf(stderr, "variants: %lu, frames: %lu, %.0f frames per second", variants, frames, seconds > 0 ? frames/seconds : 0);
+  if(compare){fprintf(stderr, ", native vs. gfx: %lu frames differ", differences);}
+  if(writeGolden){fprintf(stderr, ", golden file written");}
+  else if(golden){fprintf(stderr, ", golden: %lu mismatches, %lu missing", goldenMismatches, goldenMissing);}
+  fprintf(stderr, "\n");
+  return (differences || goldenMismatches || goldenMissing) ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  Options options;
+  Range defaultWidths = {36, 36, 1}, defaultHeights = {36, 36, 1}, defaultRadii = {8, 8, 1}, defaultSpaces = {10, 10, 1};
+  options.widths = defaultWidths;
+  options.heights = defaultHeights;
+  options.radii = defaultRadii;
+  options.spaces = defaultSpaces;
+  options.moodList.assign(moods, moods+1);
+  options.positionList.assign(positions, positions+1);
+  options.out = 0;
+  options.golden = 0;
+  options.compare = 0;
+  bool large = 0;
+  for(int i = 1; i < argc; i++){
+    bool ok = 1;
+    if(!strcmp(argv[i], "--width") && i+1 < argc){ok = parseRange(argv[++i], options.widths);}
+    else if(!strcmp(argv[i], "--height") && i+1 < argc){ok = parseRange(argv[++i], options.heights);}
+    else if(!strcmp(argv[i], "--radius") && i+1 < argc){ok = parseRange(argv[++i], options.radii);}
+    else if(!strcmp(argv[i], "--space") && i+1 < argc){ok = parseRange(argv[++i], options.spaces);}
+    else if(!strcmp(argv[i], "--mood") && i+1 < argc){ok = parseList(argv[++i], moods, 4, options.moodList);}
+    else if(!strcmp(argv[i], "--position") && i+1 < argc){ok = parseList(argv[++i], positions, 9, options.positionList);}
+    else if(!strcmp(argv[i], "--screen") && i+1 < argc){
+      i++;
+      large = !strcmp(argv[i], "240x240");
+      ok = large || !strcmp(argv[i], "128x64");
+    }
+    else if(!strcmp(argv[i], "--out") && i+1 < argc){options.out = argv[++i];}
+    else if(!strcmp(argv[i], "--golden") && i+1 < argc){options.golden = argv[++i];}
+    else if(!strcmp(argv[i], "--compare")){options.compare = 1;}
+    else {ok = 0;}
+    if(!ok){
+      fprintf(stderr, "usage: %s [--width A:B:STEP] [--height A:B:STEP] [--radius A:B:STEP] [--space A:B:STEP]\n"
+                      "       [--mood default,tired,angry,happy|all] [--position default,n,ne,e,se,s,sw,w,nw|all]\n"
+                      "       [--screen 128x64|240x240] [--out DIR] [--compare] [--golden FILE]\n", argv[0]);
+      return 2;
+    }
+  }
+  if(large){return render<RoboEyes_Framebuffer<240, 240> >(options);}
+  return render<RoboEyes_Framebuffer<128, 64> >(options);
+}
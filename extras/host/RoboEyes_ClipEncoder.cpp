@@ -0,0 +1,178 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Records a pre-baked animation (clip) for RoboEyes_ClipPlayer, see FluxGarage_RoboEyes_Clip.h.
+ *
+ * Plays an animation sequence (closed, open, happy laugh, tired) with the real RoboEyes
+ * drawing code in simulated time, takes one frame per frame interval and stores the
+ * changed bytes of each frame, run-length encoded. The clip is written as C header to
+ * stdout. The sizes are reported on stderr, and the clip is played back with
+ * RoboEyes_ClipPlayer and compared to the recorded frames.
+ *
+ * Build and run on Linux (from this directory):
+ *   g++ -std=c++11 -O2 -I../.. RoboEyes_ClipEncoder.cpp -o roboeyes_clip
+ *   ./roboeyes_clip > boot_clip.h
+ *   ./roboeyes_clip --fps 25 --name bootClip > boot_clip.h
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "FluxGarage_RoboEyes_Framebuffer.h"
+#include "FluxGarage_RoboEyes_Clip.h"
+
+#define WIDTH 128
+#define HEIGHT 64
+#define PAGES ((HEIGHT+7)/8)
+#define MERGE_GAP 3 // unchanged bytes between two changed ones that are sent along instead of starting a new span
+
+typedef RoboEyes_Framebuffer<WIDTH, HEIGHT> ClipDisplay;
+
+// The recorded animation
+static const uint8_t bootSequence[] = {
+  SEQ_CLOSE,
+  SEQ_WAIT(500), SEQ_OPEN,
+  SEQ_WAIT(1500), SEQ_MOOD(HAPPY), SEQ_LAUGH,
+  SEQ_WAIT(1500), SEQ_MOOD(TIRED),
+  SEQ_WAIT(1500),
+  SEQ_END
+};
+
+// Run-length encode count bytes, see packet in FluxGarage_RoboEyes_Clip.h
+static void encodeBytes(std::vector<uint8_t> &out, const uint8_t *data, int count) {
+  int i = 0;
+  while(i < count){
+    int run = 1;
+    while(i+run < count && data[i+run] == data[i] && run < 128){run++;}
+    if(run >= 3){
+      out.push_back(ROBOEYES_CLIP_RUN | (run-1));
+      out.push_back(data[i]);
+      i += run;
+      continue;
+    }
+    // Literal bytes up to the next run of 3 or more
+    int start = i;
+    while(i < count && i-start < 128){
+      if(i+2 < count && data[i] == data[i+1] && data[i] == data[i+2]){break;}
+      i++;
+    }
+    out.push_back(i-start-1);
+    out.insert(out.end(), data+start, data+i);
+  }
+}
+
+// Encode the changes from prev to cur as one frame
+static void encodeFrame(std::vector<uint8_t> &out, const uint8_t *prev, const uint8_t *cur) {
+  for(int page = 0; page < PAGES; page++){
+    const uint8_t *p = prev + page*WIDTH;
+    const uint8_t *c = cur + page*WIDTH;
+    int x = 0;
+    while(x < WIDTH){
+      if(p[x] == c[x]){x++; continue;}
+      // Extend the span over short gaps of unchanged bytes
+      int x0 = x, x1 = x, gap = 0;
+      for(x++; x < WIDTH && gap <= MERGE_GAP; x++){
+        if(p[x] != c[x]){x1 = x; gap = 0;} else {gap++;}
+      }
+      x = x1+1;
+      out.push_back(page);
+      out.push_back(x0);
+      out.push_back(x1-x0);
+      encodeBytes(out, c+x0, x1-x0+1);
+    }
+  }
+  out.push_back(ROBOEYES_CLIP_END_FRAME);
+}
+
+int main(int argc, char **argv) {
+  int fps = 50;
+  const char *name = "bootClip";
+  for(int i = 1; i < argc; i++){
+    if(!strcmp(argv[i], "--fps") && i+1 < argc){fps = atoi(argv[++i]);}
+    else if(!strcmp(argv[i], "--name") && i+1 < argc){name = argv[++i];}
+    else {
+      fprintf(stderr, "usage: %s [--fps N] [--name NAME] > clip.h\n", argv[0]);
+      return 2;
+    }
+  }
+  if(fps < 4 || fps > 255){
+    fprintf(stderr, "fps must be 4...255\n");
+    return 2;
+  }
+  unsigned int interval = 1000/fps;
+
+  // Record one frame per frame interval
+  static ClipDisplay display;
+  RoboEyes<ClipDisplay> eyes(display);
+  roboEyesHostSimulation() = 1;
+  roboEyesHostSimulatedMillis() = 1;
+  eyes.begin(WIDTH, HEIGHT, fps);
+  eyes.playSequence(bootSequence);
+  std::vector<std::vector<uint8_t> > frames;
+  for(unsigned long t = 1; eyes.isSequencePlaying() || eyes.isAnimating(); t++){
+    eyes.update();
+    if(t%interval == 0){
+      frames.push_back(std::vector<uint8_t>(display.buffer, display.buffer+sizeof(display.buffer)));
+    }
+    roboEyesHostSimulatedMillis()++;
+    if(t > 600000){
+      fprintf(stderr, "animation doesn't end\n");
+      return 1;
+    }
+  }
+  frames.push_back(std::vector<uint8_t>(display.buffer, display.buffer+sizeof(display.buffer))); // final state
+
+  // Encode
+  std::vector<uint8_t> clip;
+  const uint8_t header[ROBOEYES_CLIP_HEADER_SIZE] = {'R', 'C', ROBOEYES_CLIP_VERSION, WIDTH, PAGES, (uint8_t)interval,
+                                                      (uint8_t)(frames.size() & 0xFF), (uint8_t)(frames.size() >> 8)};
+  clip.insert(clip.end(), header, header+sizeof(header));
+  static const uint8_t blank[WIDTH*PAGES] = {0};
+  for(size_t i = 0; i < frames.size(); i++){
+    encodeFrame(clip, i ? frames[i-1].data() : blank, frames[i].data());
+  }
+
+  // Play back and compare
+  ClipDisplay check;
+  RoboEyes_ClipPlayer<ClipDisplay> player(check);
+  roboEyesHostSimulatedMillis() = 0;
+  bool ok = player.play(clip.data());
+  for(size_t i = 0; ok && i < frames.size(); i++){
+    ok = player.update() && !memcmp(check.buffer, frames[i].data(), sizeof(check.buffer));
+    roboEyesHostSimulatedMillis() += interval;
+  }
+  ok = ok && !player.isPlaying();
+
+  double seconds = frames.size()*interval/1000.0;
+  printf("// Clip for RoboEyes_ClipPlayer, generated by extras/host/RoboEyes_ClipEncoder.cpp\n");
+  printf("// %u frames of %ux%u pixels, %u ms per frame (%.2f s), %u bytes\n", (unsigned int)frames.size(), WIDTH, HEIGHT, interval, seconds, (unsigned int)clip.size());
+  printf("const uint8_t %s[] PROGMEM = {", name);
+  for(size_t i = 0; i < clip.size(); i++){
+    printf("%s0x%02x%s", i%16 ? "" : "\n  ", clip[i], i+1 < clip.size() ? "," : "\n");
+  }
+  printf("};\n");
+
+  fprintf(stderr, "frames: %u, duration: %.2f s, raw: %u bytes, clip: %u bytes (%.1f%%), %.0f bytes per second, playback %s\n",
+          (unsigned int)frames.size(), seconds, (unsigned int)(frames.size()*sizeof(display.buffer)), (unsigned int)clip.size(),
+          100.0*clip.size()/(frames.size()*sizeof(display.buffer)), clip.size()/seconds, ok ? "matches" : "DIFFERS");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Benchmark and simulation harness for running RoboEyes on a desktop computer.
+ *
+ * Replays scripted scenarios (moods, laughing, confused, idle mode, autoblinker, cyclops,
+ * curious, closing and opening the eyes, slow tweening) against a simulated 128x64 SSD1306
+ * with simulated time, and prints one result line per scenario and drawing path: frames,
+ * achievable frames per second on this computer, time per section, redrawn pixels and bytes
+ * per frame, and a checksum over all frames. The paths are the compositor drawing into the
+ * display buffer (default of RoboEyes, see RoboEyes_Raster::compose()) and the display's
+ * drawing methods (GFX path), both must give the same checksum. After each scenario, the
+ * eyes must come to rest at their target position. Time and random numbers are simulated,
+ * so the pixels and bytes of a run are reproducible and can be compared between releases
+ * to catch regressions.
+ *
+ * Build and run on Linux (from this directory):
+ *   g++ -std=c++11 -O2 -I../.. RoboEyes_HostBench.cpp -o roboeyes_bench
+ *   ./roboeyes_bench                  all scenarios and both paths, CSV output
+ *   ./roboeyes_bench --json idle      only the idle scenario, JSON lines output
+ *   ./roboeyes_bench --gfx            only the display's drawing methods
+ *   ./roboeyes_bench --compose        only the compositor
+ *   ./roboeyes_bench --seconds 30 --fps 100
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+// Section times in nanoseconds of real time, while millis() runs on simulated time
+inline unsigned long benchClock() {
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now()-start).count();
+}
+#define ROBOEYES_PROFILING
+#define ROBOEYES_PROFILE_CLOCK() benchClock()
+
+#include "FluxGarage_RoboEyes_Framebuffer.h"
+#include "FluxGarage_RoboEyes.h"
+
+// Simulated SSD1306 on I2C: counts the bytes on the bus, including commands and control bytes,
+// the same way as RoboEyes_SSD1306::displayRegion() and Adafruit_SSD1306::display() send them
+class BenchDisplay : public RoboEyes_Framebuffer<128, 64>
+{
+public:
+
+unsigned long busBytes = 0;
+
+void display() {
+  RoboEyes_Framebuffer<128, 64>::display();
+  busBytes += 6 + 2*2; // command list and column end address, each transmission with a control byte
+  busBytes += sizeof(buffer) + (sizeof(buffer)+30)/31; // data with a control byte per 32 byte transmission
+}
+unsigned int displayRegion(int16_t x0, int16_t x1, uint8_t page0, uint8_t page1) {
+  unsigned int bytes = 6*2; // page and column address commands
+  unsigned int columns = x1-x0+1;
+  for(uint8_t page = page0; page <= page1; page++){
+    bytes += columns + (columns+30)/31;
+  }
+  RoboEyes_Framebuffer<128, 64>::displayRegion(x0, x1, page0, page1);
+  busBytes += bytes;
+  return bytes;
+}
+
+}; // end of class BenchDisplay
+
+typedef RoboEyes<BenchDisplay> BenchEyes;
+
+// Scenario scripts are called every simulated millisecond, t = milliseconds since start (0 = setup)
+static void scriptMood(BenchEyes &eyes, unsigned long t, unsigned char mood) {
+  static const unsigned char positions[] = {N, E, S, W, DEFAULT};
+  if(t == 0){eyes.setMood(mood);}
+  if(t%1000 == 0){eyes.setPosition(positions[(t/1000)%5]);}
+}
+static void scriptDefault(BenchEyes &eyes, unsigned long t) {scriptMood(eyes, t, DEFAULT);}
+static void scriptTired(BenchEyes &eyes, unsigned long t) {scriptMood(eyes, t, TIRED);}
+static void scriptAngry(BenchEyes &eyes, unsigned long t) {scriptMood(eyes, t, ANGRY);}
+static void scriptHappy(BenchEyes &eyes, unsigned long t) {scriptMood(eyes, t, HAPPY);}
+static void scriptLaugh(BenchEyes &eyes, unsigned long t) {
+  if(t%1000 == 0){eyes.anim_laugh();}
+}
+static void scriptConfused(BenchEyes &eyes, unsigned long t) {
+  if(t%1000 == 0){eyes.anim_confused();}
+}
+static void scriptIdle(BenchEyes &eyes, unsigned long t) {
+  if(t == 0){eyes.setIdleMode(ON, 1, 1);}
+}
+static void scriptAutoblinker(BenchEyes &eyes, unsigned long t) {
+  if(t == 0){eyes.setAutoblinker(ON, 1, 1);}
+}
+static void scriptCyclops(BenchEyes &eyes, unsigned long t) {
+  if(t == 0){eyes.setCyclops(ON); eyes.setIdleMode(ON, 1, 1); eyes.setAutoblinker(ON, 2, 1);}
+}
+static void scriptReopen(BenchEyes &eyes, unsigned long t) {
+  if(t%1000 == 0){eyes.close();}
+  if(t%1000 == 500){eyes.open();} // eyes are at rest and closed by now
+}
+static void scriptSlowTween(BenchEyes &eyes, unsigned long t) {
+  if(t == 0){eyes.setTweenHalfLife(TWEEN_POSITION, 400);} // more than 16 frames at 50 fps
+  if(t%2000 == 0){eyes.setPosition((t/2000)%2 ? SW : NE);}
+}
+static void scriptCurious(BenchEyes &eyes, unsigned long t) {
+  static const unsigned char positions[] = {W, E, NW, SE, DEFAULT};
+  if(t == 0){eyes.setCuriosity(ON);}
+  if(t%1000 == 0){eyes.setPosition(positions[(t/1000)%5]);}
+}
+
+struct Scenario {
+  const char *name;
+  void (*script)(BenchEyes &eyes, unsigned long t);
+};
+
+static const Scenario scenarios[] = {
+  {"mood_default", scriptDefault},
+  {"mood_tired", scriptTired},
+  {"mood_angry", scriptAngry},
+  {"mood_happy", scriptHappy},
+  {"laugh", scriptLaugh},
+  {"confused", scriptConfused},
+  {"idle", scriptIdle},
+  {"autoblinker", scriptAutoblinker},
+  {"cyclops", scriptCyclops},
+  {"curious", scriptCurious},
+  {"reopen", scriptReopen},
+  {"slow_tween", scriptSlowTween},
+};
+
+struct Result {
+  unsigned long frames;
+  unsigned long long nanos[4]; // per profiler section
+  unsigned long long pixels;
+  unsigned long long bytes;
+  unsigned long long busBytes;
+  uint32_t checksum;
+  bool atTarget; // came to rest at the target position after the scenario
+};
+
+// FNV-1a over the display buffer, chained over all frames
+static uint32_t checksum(uint32_t hash, const uint8_t *data, unsigned int size) {
+  for(unsigned int i = 0; i < size; i++){
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static Result run(const Scenario &scenario, unsigned long seconds, int fps, bool gfx) {
+  static BenchDisplay display; // one display buffer, cleared by begin()
+  BenchEyes eyes(display);
+  Result result;
+  memset(&result, 0, sizeof(result));
+  result.checksum = 2166136261u;
+  display.busBytes = 0;
+  roboEyesHostSimulation() = 1;
+  roboEyesHostSimulatedMillis() = 1;
+  eyes.begin(128, 64, fps);
+  eyes.setNativeRaster(!gfx);
+  uint8_t lastHead = eyes.profiler.head;
+  for(unsigned long t = 0; t < seconds*1000; t++){
+    scenario.script(eyes, t);
+    eyes.update();
+    if(eyes.profiler.head != lastHead){
+      lastHead = eyes.profiler.head;
+      result.frames++;
+      for(int i = 0; i < 4; i++){
+        result.nanos[i] += eyes.profiler.current[i];
+      }
+      result.pixels += eyes.profiler.current[ROBOEYES_PROFILE_PIXELS];
+      result.bytes += eyes.getBytesFlushed();
+      result.checksum = checksum(result.checksum, display.getBuffer(), sizeof(display.buffer));
+    }
+    roboEyesHostSimulatedMillis()++;
+  }
+  result.busBytes = display.busBytes;
+  // Let the eyes come to rest, without new blinks and idle movements
+  eyes.setAutoblinker(OFF, 0, 0);
+  eyes.setIdleMode(OFF, 0, 0);
+  for(unsigned long t = 0; t < 60000 && eyes.isAnimating(); t++){
+    eyes.update();
+    roboEyesHostSimulatedMillis()++;
+  }
+  result.atTarget = !eyes.isAnimating() && eyes.eyeLx() == eyes.eyeLxNext() && eyes.eyeLy() == eyes.eyeLyNext();
+  return result;
+}
+
+int main(int argc, char **argv) {
+  unsigned long seconds = 10;
+  int fps = 50;
+  bool paths[2] = {1, 1}; // compose, gfx
+  bool json = 0;
+  const char *only = 0;
+  for(int i = 1; i < argc; i++){
+    if(!strcmp(argv[i], "--seconds") && i+1 < argc){seconds = atol(argv[++i]);}
+    else if(!strcmp(argv[i], "--fps") && i+1 < argc){fps = atoi(argv[++i]);}
+    else if(!strcmp(argv[i], "--gfx")){paths[0] = 0; paths[1] = 1;}
+    else if(!strcmp(argv[i], "--compose")){paths[0] = 1; paths[1] = 0;}
+    else if(!strcmp(argv[i], "--json")){json = 1;}
+    else if(argv[i][0] != '-'){only = argv[i];}
+    else {
+      fprintf(stderr, "usage: %s [--seconds N] [--fps N] [--gfx | --compose] [--json] [scenario]\n", argv[0]);
+      return 2;
+    }
+  }
+  if(fps < 1 || fps > 255){
+    fprintf(stderr, "fps must be 1...255\n");
+    return 2;
+  }
+
+  if(!json){
+    printf("scenario,path,frames,host_fps,ns_tween,ns_macro,ns_raster,ns_flush,pixels_per_frame,bytes_per_frame,bus_bytes_per_frame,checksum\n");
+  }
+  bool found = 0;
+  bool failed = 0;
+  for(unsigned int s = 0; s < sizeof(scenarios)/sizeof(scenarios[0]); s++){
+    if(only && strcmp(only, scenarios[s].name)){continue;}
+    found = 1;
+    uint32_t checksums[2];
+    for(int gfx = 0; gfx <= 1; gfx++){
+      if(!paths[gfx]){continue;}
+      Result r = run(scenarios[s], seconds, fps, gfx);
+      checksums[gfx] = r.checksum;
+      if(!r.atTarget){
+        fprintf(stderr, "%s: eyes didn't come to rest at their target\n", scenarios[s].name);
+        failed = 1;
+      }
+      unsigned long frames = r.frames ? r.frames : 1;
+      unsigned long long nanos = r.nanos[0]+r.nanos[1]+r.nanos[2]+r.nanos[3];
+      double hostFps = nanos ? 1e9*r.frames/nanos : 0;
+      const char *path = gfx ? "gfx" : "compose";
+      if(json){
+        printf("{\"scenario\":\"%s\",\"path\":\"%s\",\"frames\":%lu,\"host_fps\":%.0f,\"ns_tween\":%llu,\"ns_macro\":%llu,\"ns_raster\":%llu,\"ns_flush\":%llu,"
+               "\"pixels_per_frame\":%llu,\"bytes_per_frame\":%llu,\"bus_bytes_per_frame\":%llu,\"checksum\":\"%08x\"}\n",
+               scenarios[s].name, path, r.frames, hostFps, r.nanos[0]/frames, r.nanos[1]/frames, r.nanos[2]/frames, r.nanos[3]/frames,
+               r.pixels/frames, r.bytes/frames, r.busBytes/frames, (unsigned int)r.checksum);
+      } else {
+        printf("%s,%s,%lu,%.0f,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%08x\n",
+               scenarios[s].name, path, r.frames, hostFps, r.nanos[0]/frames, r.nanos[1]/frames, r.nanos[2]/frames, r.nanos[3]/frames,
+               r.pixels/frames, r.bytes/frames, r.busBytes/frames, (unsigned int)r.checksum);
+      }
+    }
+    if(paths[0] && paths[1] && checksums[0] != checksums[1]){
+      fprintf(stderr, "%s: compose and gfx paths differ\n", scenarios[s].name);
+      failed = 1;
+    }
+  }
+  if(!found){
+    fprintf(stderr, "unknown scenario: %s\n", only);
+    return 2;
+  }
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Simulation of several displays driven by RoboEyes_Scheduler on a desktop computer.
+ *
+ * Up to ROBOEYES_MAX_DISPLAYS simulated 128x64 displays are added to a scheduler, which is
+ * updated every simulated millisecond. Checks that the frame deadlines stay spread over one
+ * frame interval as set by RoboEyes_Scheduler::add(): display n of count draws its first
+ * frames n/count of a frame interval after the first display. At the end, the simulated
+ * display memory of every display must equal its display buffer.
+ *
+ * Build and run on Linux (from this directory):
+ *   g++ -std=c++11 -O2 -I../.. RoboEyes_MultiDisplay.cpp -o roboeyes_multidisplay
+ *   ./roboeyes_multidisplay [displays] [fps] [seconds]
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FluxGarage_RoboEyes_Framebuffer.h"
+#include "FluxGarage_RoboEyes.h"
+#include "FluxGarage_RoboEyes_Scheduler.h"
+
+#define CHECKED_FRAMES 8 // frames of the opening animation whose deadlines are checked
+
+// Display keeping a simulated display memory and the times of its first transmissions
+class SimulatedDisplay : public RoboEyes_Framebuffer<128, 64>
+{
+public:
+
+uint8_t panel[128*64/8];
+unsigned long sendTimes[CHECKED_FRAMES];
+unsigned int sends = 0;
+
+void display() {
+  displayRegion(0, 127, 0, 7);
+}
+unsigned int displayRegion(int16_t x0, int16_t x1, uint8_t page0, uint8_t page1) {
+  if(sends < CHECKED_FRAMES){sendTimes[sends] = millis();}
+  sends++;
+  for(uint8_t page = page0; page <= page1; page++){
+    memcpy(panel + page*128 + x0, buffer + page*128 + x0, x1-x0+1);
+  }
+  return RoboEyes_Framebuffer<128, 64>::displayRegion(x0, x1, page0, page1);
+}
+
+}; // end of class SimulatedDisplay
+
+int main(int argc, char **argv) {
+  int count = (argc > 1) ? atoi(argv[1]) : 3;
+  int fps = (argc > 2) ? atoi(argv[2]) : 50;
+  unsigned long seconds = (argc > 3) ? atol(argv[3]) : 10;
+  if(count < 1 || count > ROBOEYES_MAX_DISPLAYS || fps < 1 || fps > 255){
+    fprintf(stderr, "usage: %s [displays 1...%d] [fps 1...255] [seconds]\n", argv[0], ROBOEYES_MAX_DISPLAYS);
+    return 2;
+  }
+  roboEyesHostSimulation() = 1;
+  roboEyesHostSimulatedMillis() = 1000;
+
+  static SimulatedDisplay displays[ROBOEYES_MAX_DISPLAYS];
+  static RoboEyes<SimulatedDisplay> eyes[ROBOEYES_MAX_DISPLAYS] = {displays[0], displays[1], displays[2], displays[3]};
+  RoboEyes_Scheduler scheduler;
+  unsigned long start = millis();
+  for(int i = 0; i < count; i++){
+    eyes[i].begin(128, 64, fps);
+    eyes[i].setRandomSeed(i+1);
+    eyes[i].setAutoblinker(ON, 2, 2);
+    eyes[i].setIdleMode(ON, 2, 2);
+    scheduler.add(eyes[i], i);
+    displays[i].sends = 0; // not counting the empty frame sent by begin()
+  }
+  while(millis()-start < seconds*1000){
+    scheduler.update();
+    roboEyesHostSimulatedMillis()++;
+  }
+  // Let the last frames reach the displays
+  for(int i = 0; i < count; i++){
+    eyes[i].setAutoblinker(OFF, 0, 0);
+    eyes[i].setIdleMode(OFF, 0, 0);
+  }
+  while(scheduler.msUntilNextWork() != ROBOEYES_NO_WORK){
+    scheduler.update();
+    roboEyesHostSimulatedMillis()++;
+  }
+
+  bool ok = 1;
+  unsigned long interval = eyes[0].frameInterval;
+  printf("display,first_frame_ms,expected_ms,staggered,frames,bytes,missed_frames,panel_matches\n");
+  for(int i = 0; i < count; i++){
+    SimulatedDisplay &d = displays[i];
+    unsigned long offset = interval*i/count;
+    bool staggered = d.sends >= CHECKED_FRAMES;
+    for(int f = 0; f < CHECKED_FRAMES && staggered; f++){
+      staggered = (d.sendTimes[f]-start == offset + f*interval);
+    }
+    bool matches = !memcmp(d.panel, d.buffer, sizeof(d.panel));
+    printf("%d,%lu,%lu,%s,%u,%lu,%u,%s\n", i, d.sends ? d.sendTimes[0]-start : 0, offset, staggered ? "yes" : "no",
+           d.sends, d.bytesSent, eyes[i].getMissedFrames(), matches ? "yes" : "no");
+    ok = ok && staggered && matches;
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+/*
+ * FluxGarage RoboEyes for OLED Displays V 1.0-beta
+ * Stress test of the command queue (FluxGarage_RoboEyes_Commands.h) on a desktop computer.
+ *
+ * 1. Queue: several producer threads add numbered commands as fast as they can, retrying
+ *    while the queue is full, and one consumer thread takes them. Every command must arrive
+ *    exactly once and in the order of its producer.
+ * 2. Render task: the eyes are drawn in a thread of their own, which runs the queued
+ *    commands before each update(), while sensor and network threads send moods, blinks,
+ *    animations and gaze readings at full speed. Afterwards, the last commands are sent and
+ *    the eyes come to rest, and the frame must equal the frame of a single threaded run.
+ *
+ * Build and run on Linux (from this directory), optionally with -fsanitize=thread to check
+ * for data races:
+ *   g++ -std=c++11 -O2 -pthread -I../.. RoboEyes_RenderTask.cpp -o roboeyes_rendertask
+ *   ./roboeyes_rendertask [producers] [commands per producer] [seconds]
+ *
+ * Copyright (C) 2024 Dennis Hoelscher
+ * www.fluxgarage.com
+ * www.youtube.com/@FluxGarage
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "FluxGarage_RoboEyes_Framebuffer.h"
+#include "FluxGarage_RoboEyes.h"
+#include "FluxGarage_RoboEyes_Commands.h"
+
+typedef RoboEyes_Framebuffer<128, 64> RenderDisplay;
+
+// Producers send (producer, number) as gaze commands, the consumer checks the numbers of each producer (16 bit, wrapping)
+static bool queueTest(int producers, int count) {
+  static RoboEyes_CommandQueue<64> queue;
+  std::vector<std::thread> threads;
+  std::atomic<unsigned long> retries(0);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(int p = 0; p < producers; p++){
+    threads.push_back(std::thread([&, p]{
+      for(int i = 0; i < count; i++){
+        while(!queue.push(ROBOEYES_OP_GAZE, 0, p, (int16_t)i)){
+          retries++;
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+  std::vector<int> expected(producers, 0);
+  long received = 0, errors = 0;
+  while(received < (long)producers*count){
+    RoboEyes_Command command;
+    if(!queue.pop(command)){
+      std::this_thread::yield();
+      continue;
+    }
+    if(command.x < 0 || command.x >= producers || command.y != (int16_t)expected[command.x]){
+      if(!errors){fprintf(stderr, "unexpected command: producer %d number %d\n", command.x, command.y);}
+      errors++;
+    } else {
+      expected[command.x]++;
+    }
+    received++;
+  }
+  for(size_t i = 0; i < threads.size(); i++){threads[i].join();}
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+  bool ok = !errors && queue.empty();
+  printf("queue,%d,%ld,%.0f,%lu,%ld,%s\n", producers, received, received/seconds, (unsigned long)retries, errors, ok ? "yes" : "no");
+  return ok;
+}
+
+// Bring the eyes into a known state, the same commands for the threaded and the reference run
+template <class Target>
+static void finalCommands(Target &target) {
+  target.setIdleMode(OFF);
+  target.setAutoblinker(OFF);
+  target.setMood(HAPPY);
+  target.setCuriosity(ON);
+  target.setGaze(12000, -8000);
+  target.open();
+}
+
+// Render thread draws while producer threads send commands, returns true if the frame at rest is right
+static bool renderTest(int producers, unsigned long seconds) {
+  static RenderDisplay display, reference;
+  static RoboEyes_CommandQueue<32> queue;
+  RoboEyes<RenderDisplay> eyes(display);
+  std::atomic<bool> producing(true), rendering(true), resting(false);
+  std::atomic<unsigned long> sent(0), dropped(0), frames(0);
+  eyes.begin(128, 64, 100);
+  eyes.setGazeLimits(400, 4000);
+
+  std::thread renderer([&]{
+    unsigned long lastFrame = eyes.fpsTimer;
+    while(rendering){
+      eyes.runCommands(queue);
+      eyes.update();
+      if(eyes.fpsTimer != lastFrame){lastFrame = eyes.fpsTimer; frames++;}
+      resting = !eyes.isAnimating() && queue.empty(); // the eyes are only read by this thread
+      std::this_thread::yield();
+    }
+  });
+
+  std::vector<std::thread> threads;
+  for(int p = 0; p < producers; p++){
+    threads.push_back(std::thread([&, p]{
+      unsigned int state = 1234567u*(p+1);
+      while(producing){
+        state = state*1103515245u+12345u;
+        unsigned int r = state >> 8;
+        bool ok = 1;
+        if(p == 0){
+          ok = queue.setGaze((int16_t)r, (int16_t)(r >> 8)); // sensor thread, gaze readings only
+        } else {
+          switch(r % 8){
+          case 0: ok = queue.setMood(r/8 % 4); break;
+          case 1: ok = queue.blink(); break;
+          case 2: ok = queue.anim_laugh(); break;
+          case 3: ok = queue.anim_confused(); break;
+          case 4: ok = queue.setPosition(r/8 % 9); break;
+          case 5: ok = queue.setCuriosity(r/8 % 2); break;
+          case 6: ok = queue.setIdleMode(r/8 % 2); break;
+          default: ok = queue.setAutoblinker(r/8 % 2); break;
+          }
+        }
+        if(ok){sent++;} else {dropped++;}
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+    }));
+  }
+  std::this_thread::sleep_for(std::chrono::seconds(seconds));
+  producing = false;
+  for(size_t i = 0; i < threads.size(); i++){threads[i].join();}
+
+  // Last commands, then wait until they are run and the eyes are at rest
+  finalCommands(queue);
+  while(!queue.empty()){std::this_thread::yield();}
+  std::this_thread::sleep_for(std::chrono::milliseconds(1500)); // long enough for flickers and blinks to end
+  while(!resting){std::this_thread::sleep_for(std::chrono::milliseconds(10));}
+  rendering = false;
+  renderer.join();
+
+  // Same final state, single threaded
+  RoboEyes<RenderDisplay> single(reference);
+  single.begin(128, 64, 100);
+  single.setGazeLimits(400, 4000);
+  finalCommands(single);
+  while(single.isAnimating()){single.update();}
+
+  bool ok = !memcmp(display.buffer, reference.buffer, sizeof(display.buffer));
+  printf("render,%d,%lu,%lu,%lu,%s\n", producers, (unsigned long)sent, (unsigned long)dropped, (unsigned long)frames, ok ? "yes" : "no");
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  int producers = (argc > 1) ? atoi(argv[1]) : 4;
+  int count = (argc > 2) ? atoi(argv[2]) : 1000000;
+  unsigned long seconds = (argc > 3) ? atol(argv[3]) : 3;
+  if(producers < 1){producers = 1;}
+  printf("test,producers,commands,commands_per_second,retries_when_full,errors,ok\n");
+  bool ok = queueTest(producers, count);
+  printf("test,producers,commands_sent,commands_dropped,frames,frame_matches\n");
+  ok = renderTest(producers, seconds) && ok;
+  return ok ? 0 : 1;
+}